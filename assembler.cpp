@@ -0,0 +1,765 @@
+#include "assembler.h"
+
+#include "disassembler.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+static std::string_view trim(std::string_view text)
+{
+  while(!text.empty() && std::isspace(uint8_t(text.front())))
+    text.remove_prefix(1);
+  while(!text.empty() && std::isspace(uint8_t(text.back())))
+    text.remove_suffix(1);
+  return text;
+}
+
+static std::string upper(std::string_view text)
+{
+  std::string result(text);
+  for(char& c : result)
+    c = char(std::toupper(uint8_t(c)));
+  return result;
+}
+
+static bool is_symbol_char(char c)
+{
+  return std::isalnum(uint8_t(c)) || c == '_' || c == '.' || c == '@';
+}
+
+// splits at the commas outside parentheses and quotes
+static std::vector<std::string_view> split_operands(std::string_view text)
+{
+  std::vector<std::string_view> parts;
+  int depth = 0;
+  char quote = 0;
+  std::size_t start = 0;
+  for(std::size_t pos = 0; pos < text.size(); ++pos)
+  {
+    char c = text[pos];
+    if(quote)
+    {
+      if(c == quote)
+        quote = 0;
+    }
+    else if(c == '\'' || c == '"')
+      quote = c;
+    else if(c == '(')
+      ++depth;
+    else if(c == ')')
+      --depth;
+    else if(c == ',' && !depth)
+    {
+      parts.push_back(trim(text.substr(start, pos - start)));
+      start = pos + 1;
+    }
+  }
+  parts.push_back(trim(text.substr(start)));
+  return parts;
+}
+
+// whether the parenthesis opening text is closed by its last character, as in "($20)"
+// but not "(2 + 3) * 4"
+static bool enclosed(std::string_view text)
+{
+  if(text.size() < 2 || text.front() != '(' || text.back() != ')')
+    return false;
+  int depth = 0;
+  for(std::size_t pos = 0; pos < text.size(); ++pos)
+  {
+    if(text[pos] == '(')
+      ++depth;
+    else if(text[pos] == ')' && !--depth)
+      return pos + 1 == text.size();
+  }
+  return false;
+}
+
+static bool is_register(std::string_view text, char name)
+{
+  return text.size() == 1 && std::toupper(uint8_t(text[0])) == name;
+}
+
+// The operand with each expression replaced by e and without blanks, e.g. "(e),Y".  The
+// expressions are appended in order.
+static std::string operand_shape(std::string_view operand, std::vector<std::string_view>& expressions)
+{
+  std::string shape;
+  if(operand.empty())
+    return shape;
+
+  std::vector<std::string_view> parts = split_operands(operand);
+  for(std::size_t index = 0; index < parts.size(); ++index)
+  {
+    std::string_view part = parts[index];
+    if(index)
+      shape.push_back(',');
+
+    if(is_register(part, 'X') || is_register(part, 'Y') || (is_register(part, 'A') && parts.size() == 1))
+      shape.push_back(char(std::toupper(uint8_t(part[0]))));
+    else if(part.starts_with('#'))
+    {
+      shape.append("#e");
+      expressions.push_back(trim(part.substr(1)));
+    }
+    else if(enclosed(part))
+    {
+      std::vector<std::string_view> inner = split_operands(part.substr(1, part.size() - 2));
+      if(inner.size() == 1)
+        shape.append("(e)");
+      else if(inner.size() == 2 && is_register(inner[1], 'X'))
+        shape.append("(e,X)");
+      else
+        throw "unknown operand: "s + std::string(operand);
+      expressions.push_back(inner[0]);
+    }
+    else
+    {
+      shape.push_back('e');
+      expressions.push_back(part);
+    }
+  }
+  return shape;
+}
+
+// the same shape for a disassembler operand template
+static std::string template_shape(std::string_view operands)
+{
+  std::string shape;
+  for(char c : operands)
+  {
+    switch(c)
+    {
+    case disassembler::byte_operand:
+    case disassembler::word_operand:
+    case disassembler::relative_operand:
+      shape.push_back('e');
+      break;
+    case '$':
+    case ' ':
+      break;
+    default:
+      shape.push_back(c);
+    }
+  }
+  return shape;
+}
+
+static bool is_directive(std::string_view word)
+{
+  if(word.starts_with('.'))
+    word.remove_prefix(1);
+  for(std::string_view name : { "ORG"sv, "BANK"sv, "DB"sv, "BYTE"sv, "DW"sv, "WORD"sv, "DS"sv, "INCBIN"sv, "INCLUDE"sv, "EQU"sv })
+    if(word == name)
+      return true;
+  return false;
+}
+
+static bool has_mode(modes_t mode_data, modes_t mode)
+{
+  for(uint32_t data = mode_data; data; data >>= 4)
+    if((data & 0xF) == mode)
+      return true;
+  return false;
+}
+
+// ----------------------------------------------------------------------------
+
+// recursive descent over C precedence, loosest level first
+class assembler::expression_parser
+{
+public:
+  expression_parser(assembler& owner, std::string_view text)
+    : owner(owner), text(text) { }
+
+  value parse(void)
+  {
+    value result = binary(0);
+    skip_space();
+    if(pos != text.size())
+      throw "unexpected '"s + std::string(text.substr(pos)) + "' in expression";
+    return result;
+  }
+
+private:
+  static constexpr std::array<std::array<std::string_view, 3>, 6> levels =
+  { {
+    { "|"sv },
+    { "^"sv },
+    { "&"sv },
+    { "<<"sv, ">>"sv },
+    { "+"sv, "-"sv },
+    { "*"sv, "/"sv, "%"sv },
+  } };
+
+  void skip_space(void)
+  {
+    while(pos < text.size() && std::isspace(uint8_t(text[pos])))
+      ++pos;
+  }
+
+  value binary(std::size_t level)
+  {
+    if(level == levels.size())
+      return unary();
+
+    value left = binary(level + 1);
+    for(;;)
+    {
+      skip_space();
+      std::string_view op;
+      for(std::string_view candidate : levels[level])
+        if(!candidate.empty() && text.substr(pos).starts_with(candidate))
+          op = candidate;
+      if(op.empty())
+        return left;
+      pos += op.size();
+
+      value right = binary(level + 1);
+      if(!left.known || !right.known)
+        left = { 0, false };
+      else if(op == "|"sv)  left.number |= right.number;
+      else if(op == "^"sv)  left.number ^= right.number;
+      else if(op == "&"sv)  left.number &= right.number;
+      else if(op == "<<"sv) left.number <<= right.number;
+      else if(op == ">>"sv) left.number >>= right.number;
+      else if(op == "+"sv)  left.number += right.number;
+      else if(op == "-"sv)  left.number -= right.number;
+      else if(op == "*"sv)  left.number *= right.number;
+      else if(!right.number)
+        throw "division by zero"s;
+      else if(op == "/"sv)  left.number /= right.number;
+      else                  left.number %= right.number;
+    }
+  }
+
+  value unary(void)
+  {
+    skip_space();
+    if(pos == text.size())
+      throw "missing value in expression"s;
+
+    char c = text[pos];
+    if(c == '-' || c == '~' || c == '!' || c == '<' || c == '>')
+    {
+      ++pos;
+      value operand = unary();
+      switch(c)
+      {
+      case '-': operand.number = -operand.number; break;
+      case '~': operand.number = ~operand.number; break;
+      case '!': operand.number = !operand.number; break;
+      case '<': operand.number &= 0xFF; break;
+      case '>': operand.number = (operand.number >> 8) & 0xFF; break;
+      }
+      return operand;
+    }
+    return primary();
+  }
+
+  value number(int base, std::size_t start)
+  {
+    int32_t result = 0;
+    for(; pos < text.size() && std::isxdigit(uint8_t(text[pos])); ++pos)
+    {
+      int digit = std::isdigit(uint8_t(text[pos])) ? text[pos] - '0' : std::toupper(uint8_t(text[pos])) - 'A' + 10;
+      if(digit >= base)
+        break;
+      result = result * base + digit;
+    }
+    if(pos == start)
+      throw "malformed number"s;
+    return { result, true };
+  }
+
+  value primary(void)
+  {
+    char c = text[pos];
+    if(c == '(')
+    {
+      ++pos;
+      value result = binary(0);
+      skip_space();
+      if(pos == text.size() || text[pos] != ')')
+        throw "missing ) in expression"s;
+      ++pos;
+      return result;
+    }
+    if(c == '$')
+      return number(16, ++pos);
+    if(c == '%')
+      return number(2, ++pos);
+    if(std::isdigit(uint8_t(c)))
+      return number(10, pos);
+    if(c == '*')
+    {
+      ++pos;
+      return { int32_t(owner.statement_address), true };
+    }
+    if(c == '\'')
+    {
+      if(pos + 2 >= text.size() || text[pos + 2] != '\'')
+        throw "malformed character constant"s;
+      pos += 3;
+      return { uint8_t(text[pos - 2]), true };
+    }
+    if(!is_symbol_char(c))
+      throw "unexpected '"s + c + "' in expression";
+
+    std::size_t start = pos;
+    while(pos < text.size() && is_symbol_char(text[pos]))
+      ++pos;
+    std::string_view name = text.substr(start, pos - start);
+
+    skip_space();
+    if(pos < text.size() && text[pos] == '(')
+    {
+      std::string function = upper(name);
+      if(function == "BANK")
+      {
+        ++pos;
+        skip_space();
+        start = pos;
+        while(pos < text.size() && is_symbol_char(text[pos]))
+          ++pos;
+        const symbol* found = lookup(text.substr(start, pos - start));
+        skip_space();
+        if(pos == text.size() || text[pos] != ')')
+          throw "BANK() takes a label"s;
+        ++pos;
+        if(found && found->bank < 0)
+          throw "BANK() of an equate: "s + std::string(text.substr(start));
+        return found ? value { found->bank, found->known } : value { 0, false };
+      }
+      if(function == "LOW" || function == "HIGH")
+      {
+        value operand = primary();
+        operand.number = function == "LOW" ? operand.number & 0xFF : (operand.number >> 8) & 0xFF;
+        return operand;
+      }
+    }
+
+    const symbol* found = lookup(name);
+    return found ? value { found->value, found->known } : value { 0, false };
+  }
+
+  // nullptr for a forward reference in the first pass
+  const symbol* lookup(std::string_view name)
+  {
+    auto found = owner.symbol_table.find(owner.scoped_name(name));
+    if(found == std::end(owner.symbol_table) || (owner.pass == 2 && !found->second.known))
+    {
+      if(owner.pass == 2)
+        throw "undefined symbol: "s + std::string(name);
+      return nullptr;
+    }
+    return &found->second;
+  }
+
+  assembler& owner;
+  std::string_view text;
+  std::size_t pos = 0;
+};
+
+// ----------------------------------------------------------------------------
+
+assembler::assembler(isa target)
+  : target(target),
+    zero_page_base(target == HuC6280 ? 0x2000 : 0x0000)
+{
+  zero_page_operand.fill(-1);
+  const opcode_table_t& table = opcode_table(target);
+  for(std::size_t opcode = 0; opcode < table.size(); ++opcode)
+  {
+    const opcode_entry& entry = table[opcode];
+    if(!entry.valid())
+      continue;
+
+    std::string operands = disassembler::operand_template(entry.mode_data);
+    for(char c : operands)
+      if(c == disassembler::byte_operand || c == disassembler::word_operand || c == disassembler::relative_operand)
+        operand_codes[opcode].push_back(c);
+
+    // the zero page address follows the immediate of TST and precedes the branch of BBR
+    if(has_mode(entry.mode_data, ZeroPage))
+      zero_page_operand[opcode] = int8_t(operand_codes[opcode].find_last_of(disassembler::byte_operand));
+
+    mnemonic_forms* named = &mnemonics[std::size_t(mnemonic_index(entry.mnemonic()))];
+    named->mnemonic = entry.mnemonic();
+
+    std::string shape = template_shape(operands);
+    auto form = std::find_if(std::begin(named->forms), std::end(named->forms),
+                             [&shape](const operand_form& f) { return f.shape == shape; });
+    if(form == std::end(named->forms))
+      form = named->forms.insert(std::end(named->forms), { shape });
+
+    // absolute rows pair with the zero page row of the same shape
+    int16_t& slot = has_mode(entry.mode_data, Absolute) ? form->long_opcode : form->short_opcode;
+    if(slot >= 0)
+      throw "two opcodes for "s + named->mnemonic + " " + shape;
+    slot = int16_t(opcode);
+  }
+}
+
+const assembler::mnemonic_forms* assembler::find_mnemonic(std::string_view mnemonic) const
+{
+  int index = mnemonic_index(mnemonic);
+  if(index < 0 || mnemonics[std::size_t(index)].forms.empty())
+    return nullptr;
+  return &mnemonics[std::size_t(index)];
+}
+
+assembler::value assembler::evaluate(std::string_view text)
+{
+  return expression_parser(*this, trim(text)).parse();
+}
+
+std::string assembler::scoped_name(std::string_view name) const
+{
+  if(name.starts_with('.'))
+    return global_label + std::string(name);
+  return std::string(name);
+}
+
+void assembler::define(std::string_view name, value v, int32_t symbol_bank)
+{
+  std::string scoped = scoped_name(name);
+  if(!defined.insert(scoped).second)
+    throw "symbol defined twice: "s + scoped;
+
+  symbol& entry = symbol_table[scoped];
+  if(pass == 2 && symbol_bank >= 0 && (entry.value != v.number || entry.bank != symbol_bank))
+    throw "label moved between passes: "s + scoped;
+  entry = { v.number, symbol_bank, v.known };
+}
+
+const std::string& assembler::read_file(const std::string& filename)
+{
+  auto found = files.find(filename);
+  if(found != std::end(files))
+    return found->second;
+
+  std::ifstream fileIn(filename, std::ios::binary);
+  if(!fileIn)
+    throw "unable to open: "s + filename;
+  return files[filename] = std::string((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+}
+
+void assembler::emit(uint8_t byte)
+{
+  if(address > 0xFFFF || (address & 0xE000) != segment)
+    throw "code runs past the end of its 8KB bank"s;
+
+  if(pass == 2)
+  {
+    std::size_t offset = std::size_t(bank) * 0x2000 + (address & 0x1FFF);
+    if(image.size() <= offset)
+      image.resize(offset + 1, 0);
+    image[offset] = byte;
+  }
+  ++address;
+}
+
+// ----------------------------------------------------------------------------
+
+void assembler::process_instruction(std::string_view mnemonic, std::string_view operand)
+{
+  const mnemonic_forms* named = find_mnemonic(mnemonic);
+  if(!named)
+    throw "unknown instruction: "s + std::string(mnemonic);
+
+  std::vector<std::string_view> expressions;
+  std::string shape = operand_shape(operand, expressions);
+  auto form = std::find_if(std::begin(named->forms), std::end(named->forms),
+                           [&shape](const operand_form& f) { return f.shape == shape; });
+  if(form == std::end(named->forms) && shape.empty()) // "ASL" for "ASL A"
+    form = std::find_if(std::begin(named->forms), std::end(named->forms),
+                        [](const operand_form& f) { return f.shape == "A"sv; });
+  if(form == std::end(named->forms))
+    throw "no form of "s + named->mnemonic + " takes \"" + std::string(operand) + "\"";
+
+  std::vector<value> values;
+  for(std::string_view text : expressions)
+    values.push_back(evaluate(text));
+
+  // Zero page when the address is known to be in it.  A forward reference takes the absolute
+  // form, and the second pass must make the same choice for the addresses to hold.
+  uint8_t opcode;
+  if(pass == 1)
+  {
+    bool fits = form->long_opcode < 0 ||
+                (!expressions.empty() && (expressions.back().starts_with('<') ||
+                                          (values.back().known && values.back().number >= zero_page_base &&
+                                           values.back().number <= zero_page_base + 0xFF)));
+    opcode = uint8_t(fits && form->short_opcode >= 0 ? form->short_opcode : form->long_opcode);
+    chosen_opcodes.push_back(opcode);
+  }
+  else
+    opcode = chosen_opcodes[instruction_index];
+  ++instruction_index;
+
+  const opcode_entry& entry = opcode_table(target)[opcode];
+  uint32_t next = address + entry.byte_count;
+  emit(opcode);
+  for(std::size_t index = 0; index < values.size(); ++index)
+  {
+    int32_t number = values[index].number;
+    switch(operand_codes[opcode][index])
+    {
+    case disassembler::byte_operand:
+      // a logical zero page address is written as its offset into the page
+      if(int(index) == zero_page_operand[opcode] && number >= zero_page_base && number <= zero_page_base + 0xFF)
+        number -= zero_page_base;
+      if(pass == 2 && (number < -128 || number > 0xFF))
+        throw "operand does not fit in a byte: "s + std::string(expressions[index]);
+      emit(uint8_t(number));
+      break;
+    case disassembler::word_operand:
+      if(pass == 2 && (number < -32768 || number > 0xFFFF))
+        throw "operand does not fit in a word: "s + std::string(expressions[index]);
+      emit(uint8_t(number));
+      emit(uint8_t(number >> 8));
+      break;
+    case disassembler::relative_operand:
+      number -= int32_t(next);
+      if(pass == 2 && (number < -128 || number > 127))
+        throw "branch out of range by "s + std::to_string(number < 0 ? -128 - number : number - 127) + " bytes";
+      emit(uint8_t(number));
+      break;
+    }
+  }
+}
+
+void assembler::process_directive(std::string_view directive, std::string_view operand)
+{
+  auto known = [this](std::string_view text) -> int32_t
+  {
+    value v = evaluate(text);
+    if(!v.known)
+      throw "value must be known in the first pass: "s + std::string(text);
+    return v.number;
+  };
+
+  std::string name = upper(directive.starts_with('.') ? directive.substr(1) : directive);
+  if(name == "ORG")
+  {
+    int32_t origin = known(operand);
+    if(origin < 0 || origin > 0xFFFF)
+      throw "origin out of range"s;
+    address = uint32_t(origin);
+    segment = address & 0xE000;
+  }
+  else if(name == "BANK")
+  {
+    int32_t number = known(operand);
+    if(number < 0 || number > 0xFF)
+      throw "bank out of range"s;
+    bank = number;
+  }
+  else if(name == "DB" || name == "BYTE")
+  {
+    for(std::string_view part : split_operands(operand))
+    {
+      if(part.size() >= 2 && part.front() == '"' && part.back() == '"')
+      {
+        for(char c : part.substr(1, part.size() - 2))
+          emit(uint8_t(c));
+        continue;
+      }
+      value v = evaluate(part);
+      if(pass == 2 && (v.number < -128 || v.number > 0xFF))
+        throw "value does not fit in a byte: "s + std::string(part);
+      emit(uint8_t(v.number));
+    }
+  }
+  else if(name == "DW" || name == "WORD")
+  {
+    for(std::string_view part : split_operands(operand))
+    {
+      value v = evaluate(part);
+      if(pass == 2 && (v.number < -32768 || v.number > 0xFFFF))
+        throw "value does not fit in a word: "s + std::string(part);
+      emit(uint8_t(v.number));
+      emit(uint8_t(v.number >> 8));
+    }
+  }
+  else if(name == "DS")
+  {
+    std::vector<std::string_view> parts = split_operands(operand);
+    int32_t count = known(parts[0]);
+    uint8_t fill = parts.size() > 1 ? uint8_t(evaluate(parts[1]).number) : 0;
+    if(count < 0)
+      throw "negative size"s;
+    for(; count; --count)
+      emit(fill);
+  }
+  else if(name == "INCBIN")
+  {
+    if(operand.size() < 2 || operand.front() != '"' || operand.back() != '"')
+      throw "file name must be quoted"s;
+    for(char c : read_file(directory + std::string(operand.substr(1, operand.size() - 2))))
+      emit(uint8_t(c));
+  }
+  else
+    throw "unknown directive: "s + std::string(directive);
+}
+
+std::string assembler::process_line(std::string_view line)
+{
+  // drop the comment
+  char quote = 0;
+  for(std::size_t pos = 0; pos < line.size(); ++pos)
+  {
+    if(quote)
+    {
+      if(line[pos] == quote)
+        quote = 0;
+    }
+    else if(line[pos] == '\'' || line[pos] == '"')
+      quote = line[pos];
+    else if(line[pos] == ';')
+    {
+      line = line.substr(0, pos);
+      break;
+    }
+  }
+
+  statement_address = address;
+  std::string_view rest = trim(line);
+  if(rest.empty())
+    return std::string();
+
+  // a label starts in column 0 or ends with a colon
+  std::string_view label;
+  std::size_t length = 0;
+  while(length < rest.size() && is_symbol_char(rest[length]))
+    ++length;
+  bool colon = length < rest.size() && rest[length] == ':';
+  if(length && (colon || (!std::isspace(uint8_t(line[0])) && !(rest[0] == '.' && is_directive(upper(rest.substr(0, length)))))))
+  {
+    label = rest.substr(0, length);
+    rest = rest.substr(length);
+    if(rest.starts_with(':'))
+      rest.remove_prefix(1);
+    rest = trim(rest);
+  }
+
+  length = 0;
+  if(rest.starts_with('='))
+    length = 1;
+  else
+    while(length < rest.size() && is_symbol_char(rest[length]))
+      ++length;
+  std::string word = upper(rest.substr(0, length));
+  std::string_view operand = trim(rest.substr(length));
+
+  if(word == "=" || word == "EQU" || word == ".EQU")
+  {
+    if(label.empty())
+      throw "equate without a name"s;
+    define(label, evaluate(operand), -1);
+    return std::string();
+  }
+
+  if(!label.empty())
+  {
+    define(label, { int32_t(address), true }, bank);
+    if(!label.starts_with('.'))
+      global_label = label;
+  }
+
+  if(word.empty())
+  {
+    if(!rest.empty())
+      throw "unexpected '"s + std::string(rest) + "'";
+    return std::string();
+  }
+
+  if(word == "INCLUDE" || word == ".INCLUDE")
+  {
+    if(operand.size() < 2 || operand.front() != '"' || operand.back() != '"')
+      throw "file name must be quoted"s;
+    return directory + std::string(operand.substr(1, operand.size() - 2));
+  }
+
+  if(is_directive(word))
+    process_directive(word, operand);
+  else
+    process_instruction(word, operand);
+  return std::string();
+}
+
+void assembler::process_source(std::string_view source, const std::string& name, int depth)
+{
+  if(depth > 32)
+    throw name + ": includes nested too deeply";
+
+  std::string outer_directory = directory;
+  std::size_t separator = name.find_last_of('/');
+  directory = separator == std::string::npos ? std::string() : name.substr(0, separator + 1);
+
+  std::size_t line_number = 0;
+  while(!source.empty())
+  {
+    std::size_t end = source.find('\n');
+    std::string_view line = source.substr(0, end);
+    source.remove_prefix(end == std::string_view::npos ? source.size() : end + 1);
+    if(line.ends_with('\r'))
+      line.remove_suffix(1);
+    ++line_number;
+
+    std::string include;
+    try
+    {
+      include = process_line(line);
+      if(!include.empty())
+        read_file(include);
+    }
+    catch(std::string message)
+    {
+      throw name + ":" + std::to_string(line_number) + ": " + message;
+    }
+    if(!include.empty())
+      process_source(read_file(include), include, depth + 1);
+  }
+
+  directory = outer_directory;
+}
+
+void assembler::run_pass(int number, std::string_view source, const std::string& name)
+{
+  pass = number;
+  address = 0;
+  segment = 0;
+  bank = 0;
+  instruction_index = 0;
+  global_label.clear();
+  directory.clear();
+  defined.clear();
+  process_source(source, name, 0);
+}
+
+std::vector<uint8_t> assembler::assemble_source(std::string_view source, const std::string& name)
+{
+  symbol_table.clear();
+  chosen_opcodes.clear();
+  image.clear();
+
+  run_pass(1, source, name);
+  run_pass(2, source, name);
+
+  // whole banks
+  image.resize((image.size() + 0x1FFF) & ~std::size_t(0x1FFF), 0);
+  return std::move(image);
+}
+
+std::vector<uint8_t> assembler::assemble(const std::string& filename)
+{
+  std::string source = read_file(filename);
+  return assemble_source(source, filename);
+}
@@ -0,0 +1,104 @@
+#ifndef ASSEMBLER_H
+#define ASSEMBLER_H
+
+#include "mnemonic_hash.h"
+
+#include <cstdint>
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Two-pass PCEAS syntax assembler.  The operand forms it accepts are the disassembler's
+// templates for the opcode table, so the assembler, the disassembler and the reference page
+// agree on every opcode.  The output is a HuCard image of 8KB banks: `.bank n` and
+// `.org address` place code at n * 8KB plus the address within its 8KB page.
+//
+// A label starts in column 0 or ends with a colon, and one starting with '.' is local to the
+// last global label.  `name = expression` or `name .equ expression` defines a constant.  The
+// directives are .org, .bank, .db, .dw, .ds, .include "file" and .incbin "file".  Zero page
+// addressing is used when the address starts with `<` or is known to be in the zero page, which
+// is $2000-$20FF on HuC6280 and $00-$FF on the others.
+// Expressions have C operator precedence over $hex, %binary, decimal and 'c' constants,
+// symbols, `*` for the current address, LOW(), HIGH() and BANK().
+class assembler
+{
+public:
+  assembler(isa target = HuC6280);
+
+  // Assembles filename and everything it includes.  Errors are thrown as "file:line: message".
+  std::vector<uint8_t> assemble(const std::string& filename);
+
+  // the same for source text held in memory, includes are relative to the current directory
+  std::vector<uint8_t> assemble_source(std::string_view source, const std::string& name = "<source>");
+
+  struct symbol
+  {
+    int32_t value;
+    int32_t bank;       // -1 for equates
+    bool known;         // false while a forward reference is unresolved during the first pass
+  };
+
+  const std::unordered_map<std::string, symbol>& symbols(void) const { return symbol_table; }
+
+private:
+  struct operand_form
+  {
+    std::string shape;  // e.g. "(e),Y" with every expression as e
+    int16_t short_opcode = -1;  // byte sized operand: zero page, immediate or relative
+    int16_t long_opcode = -1;   // word sized operand
+  };
+
+  struct mnemonic_forms
+  {
+    std::string mnemonic;
+    std::vector<operand_form> forms;
+  };
+
+  struct value
+  {
+    int32_t number;
+    bool known;
+  };
+
+  class expression_parser;
+
+  const mnemonic_forms* find_mnemonic(std::string_view mnemonic) const;
+  value evaluate(std::string_view text);
+  std::string scoped_name(std::string_view name) const;
+  void define(std::string_view name, value v, int32_t bank);
+
+  void run_pass(int number, std::string_view source, const std::string& name);
+  void process_source(std::string_view source, const std::string& name, int depth);
+  // returns the file named by an .include so it is processed outside the line's error context
+  std::string process_line(std::string_view line);
+  void process_instruction(std::string_view mnemonic, std::string_view operand);
+  void process_directive(std::string_view directive, std::string_view operand);
+
+  void emit(uint8_t byte);
+  const std::string& read_file(const std::string& filename);
+
+  isa target;
+  uint16_t zero_page_base;                  // logical address of the zero page
+  std::array<mnemonic_forms, mnemonic_spans.size()> mnemonics; // by mnemonic_index(), empty when not in the isa
+  std::array<std::string, 256> operand_codes; // disassembler operand codes of each opcode in order
+  std::array<int8_t, 256> zero_page_operand;  // index of the zero page address in operand_codes, -1 for none
+  std::unordered_map<std::string, symbol> symbol_table;
+  std::unordered_set<std::string> defined;  // names defined in this pass
+  std::unordered_map<std::string, std::string> files;
+
+  int pass = 1;
+  std::string directory;                    // of the file being processed, for its includes
+  std::string global_label;                 // scope of `.local` labels
+  uint32_t address = 0;
+  uint32_t statement_address = 0;           // `*` in expressions
+  uint32_t segment = 0;                     // 8KB page of the last .org, writes may not leave it
+  int32_t bank = 0;
+  std::vector<uint8_t> chosen_opcodes;      // first pass decisions replayed by the second
+  std::size_t instruction_index = 0;
+  std::vector<uint8_t> image;
+};
+
+#endif // ASSEMBLER_H
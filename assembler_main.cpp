@@ -0,0 +1,76 @@
+#include <fstream>
+#include <iostream>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+#include "assembler.h"
+
+using namespace std::literals;
+using namespace std::string_view_literals;
+
+// ----------------------------------------------------------------------------
+
+int main (int argc, char** argv)
+{
+  std::ios::sync_with_stdio(false);
+
+  isa target = HuC6280;
+  std::string symbols_filename;
+  std::vector<std::string_view> files;
+
+  for(int pos = 1; pos < argc; ++pos)
+  {
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--isa="sv))
+      target = parse_isa(arg.substr("--isa="sv.size()));
+    else if(arg.starts_with("--symbols="sv))
+      symbols_filename = arg.substr("--symbols="sv.size());
+    else
+      files.push_back(arg);
+  }
+
+  if(files.size() != 2 || target == None)
+  {
+    std::cerr << "usage: " << argv[0] << " [--isa=HuC6280|WDC65C02|NMOS6502] [--symbols=file] <source> <image>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    assembler as(target);
+    std::vector<uint8_t> image = as.assemble(std::string(files[0]));
+
+    std::ofstream fileOut(std::string(files[1]), std::ios::binary);
+    if(!fileOut.write(reinterpret_cast<const char*>(image.data()), image.size()))
+      throw "unable to write: "s + std::string(files[1]);
+
+    // "bank:address name" for labels and "value name" for equates, sorted by name
+    if(!symbols_filename.empty())
+    {
+      std::vector<std::pair<std::string_view, assembler::symbol>> sorted(std::begin(as.symbols()), std::end(as.symbols()));
+      std::sort(std::begin(sorted), std::end(sorted), [](const auto& a, const auto& b) { return a.first < b.first; });
+      std::string listing;
+      for(const auto& [name, entry] : sorted)
+      {
+        if(entry.bank < 0)
+          listing.append(std::format("{:8X} {}\n", entry.value, name));
+        else
+          listing.append(std::format("{:02X}:{:04X} {}\n", entry.bank, entry.value, name));
+      }
+      std::ofstream symbolsOut(symbols_filename, std::ios::binary);
+      if(!symbolsOut.write(listing.data(), listing.size()))
+        throw "unable to write: "s + symbols_filename;
+    }
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return 0;
+}
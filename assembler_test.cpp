@@ -0,0 +1,92 @@
+#include <iostream>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+#include "assembler.h"
+#include "disassembler.h"
+
+using namespace std::literals;
+
+// ----------------------------------------------------------------------------
+
+// Assembles single instructions, compares the bytes and disassembles them again.  The cases
+// are the zero page choices: $2000-$20FF on HuC6280 and $00-$FF on the 6502s.
+
+struct test_case
+{
+  isa target;
+  std::string_view source;
+  std::vector<uint8_t> bytes;
+  std::string_view listing;   // the disassembler's text for the bytes
+};
+
+static const std::vector<test_case> cases =
+{
+  { HuC6280,  "sta $0002",        { 0x8D, 0x02, 0x00 }, "STA $0002" },
+  { HuC6280,  "lda $2010",        { 0xA5, 0x10 },       "LDA $10" },
+  { HuC6280,  "lda <$2010",       { 0xA5, 0x10 },       "LDA $10" },
+  { HuC6280,  "lda $20FF, x",     { 0xB5, 0xFF },       "LDA $FF, X" },
+  { HuC6280,  "lda $2100",        { 0xAD, 0x00, 0x21 }, "LDA $2100" },
+  { HuC6280,  "lda ($2020), y",   { 0xB1, 0x20 },       "LDA ($20), Y" },
+  { HuC6280,  "tst #$0F, $2030",  { 0x83, 0x0F, 0x30 }, "TST #$0F, $30" },
+  { WDC65C02, "sta $0002",        { 0x85, 0x02 },       "STA $02" },
+  { NMOS6502, "lda $2010",        { 0xAD, 0x10, 0x20 }, "LDA $2010" },
+  { NMOS6502, "lda <$2010",       { 0xA5, 0x10 },       "LDA $10" },
+};
+
+static std::string disassemble(isa target, const std::vector<uint8_t>& bytes)
+{
+  const disassembler dis(target);
+  std::vector<char> listing(bytes.size() * disassembler::max_line_size);
+  char* end = listing.data();
+  dis.disassemble(bytes.data(), bytes.size(), 0, end, true);
+
+  // the instruction text after the address and byte columns
+  std::string_view line(listing.data(), std::size_t(end - listing.data()));
+  line = line.substr(0, line.find('\n'));
+  line.remove_prefix(std::min(line.size(), line.find_first_not_of(' ', line.find("  ", 6))));
+  return std::string(line);
+}
+
+static std::string hex(const std::vector<uint8_t>& bytes)
+{
+  std::string text;
+  for(uint8_t byte : bytes)
+    text += std::format("{:02X} ", byte);
+  return text;
+}
+
+int main (void)
+{
+  std::size_t failures = 0;
+
+  try
+  {
+    for(const auto& test : cases)
+    {
+      assembler as(test.target);
+      // the image is padded to a whole bank, the label after the instruction gives its length
+      std::vector<uint8_t> bytes = as.assemble_source(" "s + std::string(test.source) + "\nend:\n");
+      bytes.resize(std::size_t(as.symbols().at("end").value));
+      std::string listing = disassemble(test.target, bytes);
+      if(bytes != test.bytes || listing != test.listing)
+      {
+        std::cerr << std::format("cpu {} \"{}\"\n  expected {}{}\n  got      {}{}\n", uint16_t(test.target), test.source,
+                                 hex(test.bytes), test.listing, hex(bytes), listing);
+        ++failures;
+      }
+    }
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << (failures ? std::format("{} of {} instructions differ\n", failures, cases.size()) : "all instructions match\n"s);
+  return failures ? EXIT_FAILURE : 0;
+}
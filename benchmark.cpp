@@ -0,0 +1,120 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+namespace benchmark
+{
+  struct registered
+  {
+    std::string name;
+    function body;
+  };
+
+  static std::vector<registered>& registry(void)
+  {
+    static std::vector<registered> list;
+    return list;
+  }
+
+  void register_benchmark(std::string name, function body)
+  {
+    registry().push_back({ std::move(name), std::move(body) });
+  }
+
+  static double seconds(const function& body, uint64_t iterations)
+  {
+    auto start = std::chrono::steady_clock::now();
+    body(iterations);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // the iteration count that takes about min_seconds
+  static uint64_t calibrate(const function& body, double min_seconds)
+  {
+    uint64_t iterations = 1;
+    for(;;)
+    {
+      double elapsed = seconds(body, iterations);
+      if(elapsed >= min_seconds || iterations >= 1000000000)
+        return iterations;
+      if(elapsed < min_seconds / 100)
+        iterations *= 10;
+      else
+        iterations = std::max(iterations + 1, uint64_t(iterations * min_seconds * 1.2 / elapsed));
+    }
+  }
+
+  std::vector<result> run(std::string_view filter, double min_seconds, int repetitions)
+  {
+    std::vector<result> results;
+    for(const registered& current : registry())
+    {
+      if(current.name.find(filter) == std::string::npos)
+        continue;
+
+      uint64_t iterations = calibrate(current.body, min_seconds);
+      std::vector<double> samples;
+      for(int pos = 0; pos < repetitions; ++pos)
+        samples.push_back(seconds(current.body, iterations) * 1e9 / iterations);
+      std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+      results.push_back({ current.name, iterations, samples[samples.size() / 2] });
+    }
+    return results;
+  }
+
+  std::string to_json(const std::vector<result>& results)
+  {
+    std::string output = "{\n  \"benchmarks\": [\n";
+    for(std::size_t pos = 0; pos < results.size(); ++pos)
+      output += std::format("    {{ \"name\": \"{}\", \"iterations\": {}, \"ns_per_op\": {:.3f} }}{}\n",
+                            results[pos].name, results[pos].iterations, results[pos].ns_per_op,
+                            pos + 1 < results.size() ? "," : "");
+    output += "  ]\n}\n";
+    return output;
+  }
+
+  // reads back what to_json() writes, names never need escapes
+  std::vector<result> from_json(std::string_view text)
+  {
+    std::vector<result> results;
+    auto value_of = [&text](std::string_view key, std::size_t from) -> std::size_t
+    {
+      std::size_t pos = text.find(std::format("\"{}\":", key), from);
+      if(pos == std::string_view::npos)
+        throw "baseline entry without "s + std::string(key);
+      pos = text.find_first_not_of(" \t\n", pos + key.size() + 3);
+      if(pos == std::string_view::npos)
+        throw "truncated baseline"s;
+      return pos;
+    };
+
+    for(std::size_t pos = text.find("\"name\":"sv); pos != std::string_view::npos; pos = text.find("\"name\":"sv, pos))
+    {
+      result current;
+      std::size_t start = value_of("name", pos);
+      std::size_t end = text.find('"', start + 1);
+      if(text[start] != '"' || end == std::string_view::npos)
+        throw "malformed baseline name"s;
+      current.name = text.substr(start + 1, end - start - 1);
+
+      std::size_t next = text.find("\"name\":"sv, end);
+      std::size_t iterations_pos = value_of("iterations", end);
+      std::size_t ns_per_op_pos = value_of("ns_per_op", end);
+      if(iterations_pos > next || ns_per_op_pos > next)
+        throw "incomplete baseline entry: "s + current.name;
+      std::string iterations(text.substr(iterations_pos, 24));
+      std::string ns_per_op(text.substr(ns_per_op_pos, 24));
+      current.iterations = std::strtoull(iterations.c_str(), nullptr, 10);
+      current.ns_per_op = std::strtod(ns_per_op.c_str(), nullptr);
+      results.push_back(current);
+      pos = end;
+    }
+    return results;
+  }
+}
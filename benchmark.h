@@ -0,0 +1,41 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A small micro-benchmark runner in the style of Google Benchmark.  Each case is handed an
+// iteration count and runs its kernel that many times.  The count is grown until one run
+// takes at least the minimum time, then the run is repeated and the median time per
+// iteration is reported so that results are stable enough to compare against a baseline.
+namespace benchmark
+{
+  using function = std::function<void(uint64_t iterations)>;
+
+  struct result
+  {
+    std::string name;
+    uint64_t iterations;
+    double ns_per_op;
+  };
+
+  void register_benchmark(std::string name, function body);
+
+  // runs the cases whose name contains filter, in the order they were registered
+  std::vector<result> run(std::string_view filter, double min_seconds, int repetitions);
+
+  std::string to_json(const std::vector<result>& results);
+  std::vector<result> from_json(std::string_view text);
+
+  // keeps the compiler from discarding the computation of value
+  template<typename T>
+  inline void do_not_optimize(const T& value)
+  {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,268 @@
+#include <fstream>
+#include <iostream>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+
+#include "benchmark.h"
+#include "build_instructions.h"
+#include "html_export.h"
+#include "post_processing.h"
+#include "transfer_scanner.h"
+
+using namespace std::literals;
+using namespace std::string_view_literals;
+
+// ----------------------------------------------------------------------------
+
+struct row
+{
+  const instruction* parent;
+  mode_details details;
+};
+
+// the mode row of op_mnemonic with the given opcode, as build_insn_blocks() left it
+static row find_row(const std::vector<instructions>& insn_blocks, std::string_view op_mnemonic, int opcode)
+{
+  for(const auto& block : insn_blocks)
+    for(const auto& i : block)
+    {
+      if(i.data<mnemonic>() != op_mnemonic)
+        continue;
+      if(i.data<std::vector<mode_details>>().empty() && i.data<mode_details>().opcode == opcode)
+        return { &i, i.data<mode_details>() };
+      for(const auto& md : i.data<std::vector<mode_details>>())
+        if(md.opcode == opcode)
+          return { &i, md };
+    }
+  throw std::format("no {} ${:02X} row", op_mnemonic, opcode);
+}
+
+// the state post_processing() hands to modes_decoder()
+static row decoder_input(const std::vector<instructions>& insn_blocks, std::string_view op_mnemonic, int opcode)
+{
+  row r = find_row(insn_blocks, op_mnemonic, opcode);
+  if(r.details.abstract_string.empty())
+    r.details.abstract_string = r.parent->data<abstract>();
+  return r;
+}
+
+// each case copies its input so every iteration transforms the same text
+static void register_benchmarks(const std::vector<instructions>& raw, const std::vector<instructions>& processed)
+{
+  using benchmark::register_benchmark;
+  using benchmark::do_not_optimize;
+
+  for(auto [op_mnemonic, opcode] : { std::pair { "ADC"sv, 0x61 }, std::pair { "TII"sv, 0x73 } })
+  {
+    row r = find_row(processed, op_mnemonic, opcode);
+    std::string suffix = std::format("/{}_{:02X}", op_mnemonic, opcode);
+
+    register_benchmark("fix_id"s + suffix, [machine = r.details.machine](uint64_t iterations)
+    {
+      for(uint64_t pos = 0; pos < iterations; ++pos)
+        do_not_optimize(fix_id(machine));
+    });
+    register_benchmark("build_flags"s + suffix, [&farr = r.parent->data<flags>()](uint64_t iterations)
+    {
+      for(uint64_t pos = 0; pos < iterations; ++pos)
+        do_not_optimize(build_flags(farr));
+    });
+    register_benchmark("build_isa_list"s + suffix, [md = r.details](uint64_t iterations)
+    {
+      for(uint64_t pos = 0; pos < iterations; ++pos)
+        do_not_optimize(build_isa_list(md));
+    });
+  }
+
+  row adc = decoder_input(raw, "ADC"sv, 0x61);
+  std::string abstract_text = adc.details.abstract_string;
+  std::string flag_text = std::get<std::string>(adc.parent->data<flags>()[6]);
+
+  register_benchmark("replace_symbols/ADC_abstract", [abstract_text](uint64_t iterations)
+  {
+    for(uint64_t pos = 0; pos < iterations; ++pos)
+    {
+      std::string data = abstract_text;
+      replace_symbols(data, typeable_substitutions);
+      replace_symbols(data, long_accronym_substitutions);
+      do_not_optimize(data);
+    }
+  });
+  register_benchmark("replace_symbols/ADC_flag", [flag_text](uint64_t iterations)
+  {
+    for(uint64_t pos = 0; pos < iterations; ++pos)
+    {
+      std::string data = flag_text;
+      replace_symbols(data, typeable_substitutions);
+      do_not_optimize(data);
+    }
+  });
+
+  std::string typeable_text = abstract_text;
+  replace_symbols(typeable_text, typeable_substitutions);
+  register_benchmark("replace_patterns/ADC_abstract", [typeable_text](uint64_t iterations)
+  {
+    for(uint64_t pos = 0; pos < iterations; ++pos)
+    {
+      std::string data = typeable_text;
+      replace_patterns(data, typeable_regexes);
+      replace_patterns(data, short_accronym_regexes);
+      do_not_optimize(data);
+    }
+  });
+
+  for(auto [op_mnemonic, opcode] : { std::pair { "ADC"sv, 0x61 }, std::pair { "BBR#"sv, 0x0F } })
+  {
+    row r = decoder_input(raw, op_mnemonic, opcode);
+    register_benchmark("fix_name/"s + std::string(op_mnemonic), [origin = r.parent->data<mnemonic_origin>()](uint64_t iterations)
+    {
+      for(uint64_t pos = 0; pos < iterations; ++pos)
+        do_not_optimize(fix_name(origin));
+    });
+  }
+
+  for(auto [op_mnemonic, opcode] : { std::pair { "ADC"sv, 0x61 }, std::pair { "TII"sv, 0x73 }, std::pair { "BBR#"sv, 0x0F } })
+  {
+    row r = decoder_input(raw, op_mnemonic, opcode);
+    register_benchmark(std::format("modes_decoder/{}_{:02X}", op_mnemonic, opcode), [r](uint64_t iterations)
+    {
+      for(uint64_t pos = 0; pos < iterations; ++pos)
+      {
+        mode_details details = r.details;
+        modes_decoder(*r.parent, details);
+        do_not_optimize(details);
+      }
+    });
+  }
+
+  // 1MB of the same pseudo-random bytes every run, about one in 37 is a transfer opcode
+  std::vector<uint8_t> image(0x100000);
+  uint32_t seed = 1;
+  for(uint8_t& byte : image)
+  {
+    seed = seed * 1664525 + 1013904223;
+    byte = uint8_t(seed >> 24);
+  }
+  for(scan_method method : { scalar_scan, sse2_scan, avx2_scan })
+  {
+    if(!scan_method_supported(method))
+      continue;
+    std::string_view name = method == avx2_scan ? "avx2"sv : method == sse2_scan ? "sse2"sv : "scalar"sv;
+    register_benchmark("scan_transfers/"s + std::string(name) + "_1MB", [image, method](uint64_t iterations)
+    {
+      for(uint64_t pos = 0; pos < iterations; ++pos)
+        do_not_optimize(scan_transfers(image.data(), image.size(), method, nullptr).cycles);
+    });
+  }
+}
+
+static std::string read_file(const std::string& filename)
+{
+  std::ifstream fileIn(filename, std::ios::binary);
+  if(!fileIn)
+    throw "unable to open: "s + filename;
+  return std::string((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+}
+
+// prints each case against the baseline and returns false if any is slower than threshold percent
+static bool compare(const std::vector<benchmark::result>& results, const std::vector<benchmark::result>& baseline, double threshold)
+{
+  bool passed = true;
+  std::cout << std::format("{:<32} {:>12} {:>12} {:>9}\n", "benchmark", "baseline ns", "current ns", "change");
+  for(const auto& current : results)
+  {
+    auto match = std::find_if(std::begin(baseline), std::end(baseline),
+                              [&current](const benchmark::result& entry) { return entry.name == current.name; });
+    if(match == std::end(baseline))
+    {
+      std::cout << std::format("{:<32} {:>12} {:>12.1f} {:>9}\n", current.name, "-", current.ns_per_op, "new");
+      continue;
+    }
+
+    double change = (current.ns_per_op - match->ns_per_op) * 100 / match->ns_per_op;
+    bool regressed = change > threshold;
+    passed &= !regressed;
+    std::cout << std::format("{:<32} {:>12.1f} {:>12.1f} {:>+8.1f}%{}\n",
+                             current.name, match->ns_per_op, current.ns_per_op, change, regressed ? " REGRESSION" : "");
+  }
+  return passed;
+}
+
+int main (int argc, char** argv)
+{
+  std::ios::sync_with_stdio(false);
+
+  std::string_view filter;
+  std::string baseline_filename;
+  std::string compare_filename;
+  double min_seconds = 0.1;
+  double threshold = 10;
+  int repetitions = 5;
+
+  for(int pos = 1; pos < argc; ++pos)
+  {
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--filter="sv))
+      filter = arg.substr("--filter="sv.size());
+    else if(arg.starts_with("--baseline="sv))
+      baseline_filename = arg.substr("--baseline="sv.size());
+    else if(arg.starts_with("--compare="sv))
+      compare_filename = arg.substr("--compare="sv.size());
+    else if(arg.starts_with("--min-time="sv))
+      min_seconds = std::strtod(argv[pos] + "--min-time="sv.size(), nullptr);
+    else if(arg.starts_with("--threshold="sv))
+      threshold = std::strtod(argv[pos] + "--threshold="sv.size(), nullptr);
+    else if(arg.starts_with("--repetitions="sv))
+      repetitions = std::atoi(argv[pos] + "--repetitions="sv.size());
+    else
+      repetitions = 0;
+  }
+
+  if(repetitions <= 0 || min_seconds <= 0)
+  {
+    std::cerr << "usage: " << argv[0] << " [--filter=text] [--min-time=seconds] [--repetitions=n] [--baseline=file] [--compare=file] [--threshold=percent]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    std::vector<instructions> raw;
+    build_insn_blocks(raw);
+    std::vector<instructions> processed = raw;
+    post_processing(processed);
+    register_benchmarks(raw, processed);
+
+    std::vector<benchmark::result> results = benchmark::run(filter, min_seconds, repetitions);
+
+    if(!compare_filename.empty())
+    {
+      if(!compare(results, benchmark::from_json(read_file(compare_filename)), threshold))
+        return EXIT_FAILURE;
+    }
+    else
+    {
+      std::cout << std::format("{:<32} {:>14} {:>12}\n", "benchmark", "iterations", "ns/op");
+      for(const auto& current : results)
+        std::cout << std::format("{:<32} {:>14} {:>12.1f}\n", current.name, current.iterations, current.ns_per_op);
+    }
+
+    if(!baseline_filename.empty())
+    {
+      std::ofstream baselineOut(baseline_filename, std::ios::binary);
+      std::string json = benchmark::to_json(results);
+      if(!baselineOut.write(json.data(), json.size()))
+        throw "unable to write: "s + baseline_filename;
+    }
+  }
+  catch(std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,468 @@
+#include "block_estimator.h"
+
+#include "mnemonic_hash.h"
+
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <queue>
+#include <string_view>
+
+using namespace std::literals::string_view_literals;
+
+// mode chain with every Absolute replaced by ZeroPage
+static modes_t zero_page_mode(modes_t mode_data)
+{
+  uint32_t data = mode_data;
+  for(int shift = 0; shift < 32; shift += 4)
+    if(((data >> shift) & 0xF) == Absolute)
+      data = (data & ~(0xFu << shift)) | (uint32_t(ZeroPage) << shift);
+  return modes_t(data);
+}
+
+static bool has_absolute(modes_t mode_data)
+{
+  for(int shift = 0; shift < 32; shift += 4)
+    if(((uint32_t(mode_data) >> shift) & 0xF) == Absolute)
+      return true;
+  return false;
+}
+
+static bool single_bit(uint8_t value)
+{
+  return value && !(value & (value - 1));
+}
+
+// opcode of name in mode on the table's isa, -1 if it has none.  For a "#" family, the one
+// for bit, e.g. opcode_of(table, "SMB#", ZeroPage, 3) for SMB3.
+static int opcode_of(const opcode_table_t& table, std::string_view name, modes_t mode, int bit = 0)
+{
+  const mnemonic_span* rows = find_mnemonic(name);
+  if(!rows)
+    return -1;
+  for(std::size_t row = rows->first; row < std::size_t(rows->first + rows->count); ++row)
+  {
+    const opcode_row& candidate = opcode_rows[row];
+    if(candidate.mode_data == mode && table[candidate.opcode].mnemonic() == candidate.mnemonic &&
+       (!name.ends_with('#') || candidate.mnemonic.back() == '0' + bit))
+      return candidate.opcode;
+  }
+  return -1;
+}
+
+block_estimator::block_estimator(const std::vector<uint8_t>& image, isa target)
+  : image(image),
+    table(opcode_table(target)),
+    zero_page_base(target == HuC6280 ? 0x2000 : 0x0000),
+    lda_zero_page(opcode_of(table, "LDA"sv, ZeroPage)),
+    ora_immediate(opcode_of(table, "ORA"sv, Immediate)),
+    and_immediate(opcode_of(table, "AND"sv, Immediate)),
+    sta_zero_page(opcode_of(table, "STA"sv, ZeroPage)),
+    beq_relative(opcode_of(table, "BEQ"sv, Relative)),
+    bne_relative(opcode_of(table, "BNE"sv, Relative)),
+    state(image.size(), 0),
+    slots(image.size(), 0)
+{
+  for(int bit = 0; bit < 8; ++bit)
+  {
+    smb_forms[bit] = opcode_of(table, "SMB#"sv, ZeroPage, bit);
+    rmb_forms[bit] = opcode_of(table, "RMB#"sv, ZeroPage, bit);
+    bbr_forms[bit] = opcode_of(table, "BBR#"sv, ZeroPage | Secondary | Relative, bit);
+    bbs_forms[bit] = opcode_of(table, "BBS#"sv, ZeroPage | Secondary | Relative, bit);
+  }
+
+  for(std::size_t opcode = 0; opcode < table.size(); ++opcode)
+  {
+    const opcode_entry& entry = table[opcode];
+    std::string_view name = entry.mnemonic();
+
+    if(!entry.valid())
+      flow[opcode] = stop;
+    else if(name == "JSR"sv || name == "BSR"sv)
+      flow[opcode] = call;
+    else if(entry.cost.branch_taken)
+      flow[opcode] = branch;
+    else if(name == "BRA"sv || (name == "JMP"sv && entry.mode_data == Absolute))
+      flow[opcode] = jump;
+    else if(name == "JMP"sv || name == "RTS"sv || name == "RTI"sv || name == "BRK"sv)
+      flow[opcode] = stop;
+    else
+      flow[opcode] = next;
+
+    zero_page_form[opcode] = -1;
+    if(entry.valid() && flow[opcode] == next && has_absolute(entry.mode_data))
+    {
+      modes_t wanted = zero_page_mode(entry.mode_data);
+      const mnemonic_span* rows = find_mnemonic(name);
+      for(std::size_t row = rows->first; row < std::size_t(rows->first + rows->count); ++row)
+      {
+        const opcode_entry& other = table[opcode_rows[row].opcode];
+        if(other.valid() && other.mode_data == wanted && other.mnemonic() == name)
+          zero_page_form[opcode] = opcode_rows[row].opcode;
+      }
+    }
+  }
+}
+
+uint16_t block_estimator::address_of(uint32_t offset) const
+{
+  return uint16_t((slots[offset] << 13) | (offset & (bank_size - 1)));
+}
+
+uint16_t block_estimator::branch_target(uint32_t offset) const
+{
+  const opcode_entry& entry = table[image[offset]];
+  if((entry.mode_data & 0xF) == Relative)
+    return uint16_t(address_of(offset) + entry.byte_count + int8_t(image[offset + entry.byte_count - 1]));
+  return uint16_t(image[offset + 1] | (image[offset + 2] << 8));
+}
+
+uint32_t block_estimator::target_offset(uint32_t offset, uint16_t target) const
+{
+  if((target >> 13) != slots[offset])
+    return none; // outside the slot this bank is mapped to
+  uint32_t result = (offset & ~(bank_size - 1)) | (target & (bank_size - 1));
+  return result < image.size() ? result : none;
+}
+
+void block_estimator::push(uint32_t offset, uint8_t slot)
+{
+  if(offset == none)
+    return;
+  state[offset] |= leader;
+  if(!(state[offset] & visited))
+  {
+    slots[offset] = slot;
+    worklist.push_back(offset);
+  }
+}
+
+void block_estimator::add_entry(uint32_t bank, uint16_t address)
+{
+  uint32_t offset = bank * bank_size + (address & (bank_size - 1));
+  if(offset < image.size())
+    push(offset, uint8_t(address >> 13));
+}
+
+void block_estimator::add_vectors(void)
+{
+  uint16_t first = zero_page_base ? 0xFFF6 : 0xFFFA;
+  for(uint32_t vector = first; vector <= 0xFFFE; vector += 2)
+  {
+    uint32_t offset = vector & (bank_size - 1);
+    if(offset + 1 < image.size())
+    {
+      uint16_t address = uint16_t(image[offset] | (image[offset + 1] << 8));
+      if((address >> 13) == 7)
+        add_entry(0, address);
+    }
+  }
+}
+
+void block_estimator::discover(uint32_t offset)
+{
+  if(state[offset] & visited)
+    return;
+
+  const uint8_t slot = slots[offset];
+  const uint32_t bank_end = std::min<std::size_t>((offset | (bank_size - 1)) + 1, image.size());
+  for(uint32_t pos = offset;;)
+  {
+    const opcode_entry& entry = table[image[pos]];
+    if(!entry.valid() || pos + entry.byte_count > bank_end)
+      return;
+
+    state[pos] |= visited;
+    slots[pos] = slot;
+    uint32_t following = pos + entry.byte_count;
+    switch(flow[image[pos]])
+    {
+    case call:
+      push(target_offset(pos, branch_target(pos)), slot);
+      break;
+    case branch:
+      push(target_offset(pos, branch_target(pos)), slot);
+      push(following < bank_end ? following : none, slot);
+      return;
+    case jump:
+      push(target_offset(pos, branch_target(pos)), slot);
+      return;
+    case stop:
+      return;
+    case next:
+      break;
+    }
+
+    if(following >= bank_end)
+      return;
+    if(state[following] & visited) // joins code that is already known
+    {
+      state[following] |= leader;
+      return;
+    }
+    pos = following;
+  }
+}
+
+uint32_t block_estimator::block_index(uint32_t offset) const
+{
+  if(offset == none)
+    return none;
+  auto found = std::lower_bound(std::begin(block_arena), std::end(block_arena), offset,
+                                [](const basic_block& block, uint32_t value) { return block.offset < value; });
+  return found != std::end(block_arena) && found->offset == offset ? uint32_t(found - std::begin(block_arena)) : none;
+}
+
+void block_estimator::build_blocks(void)
+{
+  for(uint32_t offset = 0; offset < image.size(); ++offset)
+  {
+    if((state[offset] & (visited | leader)) != (visited | leader))
+      continue;
+
+    basic_block block = { offset, 0, address_of(offset), 0, 0, 0, 0, none, none, none };
+    const uint32_t bank_end = std::min<std::size_t>((offset | (bank_size - 1)) + 1, image.size());
+    uint32_t pos = offset;
+    for(;;)
+    {
+      const opcode_entry& entry = table[image[pos]];
+      std::string_view name = entry.mnemonic();
+      uint32_t cycles = instruction_cycles(entry, &image[pos], false);
+      uint32_t following = pos + entry.byte_count;
+
+      block.min_cycles += cycles;
+      block.max_cycles += cycles;
+      if(name == "ADC"sv || name == "SBC"sv)
+        block.max_cycles += 1; // decimal mode
+      ++block.instruction_count;
+
+      flow_kind kind = flow[image[pos]];
+      if(kind == branch)
+      {
+        block.branch_penalty = entry.cost.branch_taken;
+        block.max_cycles += entry.cost.branch_taken;
+        block.fallthrough = following;
+      }
+      if(kind == branch || kind == jump)
+        block.taken = target_offset(pos, branch_target(pos));
+      if(kind == branch || kind == jump || kind == stop)
+      {
+        pos = following;
+        break;
+      }
+
+      pos = following;
+      if(pos >= bank_end || !(state[pos] & visited))
+        break;
+      if(state[pos] & leader)
+      {
+        block.fallthrough = pos;
+        break;
+      }
+    }
+    block.size = pos - offset;
+    block_arena.push_back(block);
+  }
+
+  // successors were recorded as offsets
+  for(basic_block& block : block_arena)
+  {
+    block.taken = block_index(block.taken);
+    block.fallthrough = block_index(block.fallthrough);
+  }
+}
+
+void block_estimator::find_loops(void)
+{
+  // strongly connected components with an iterative version of Tarjan's algorithm
+  const uint32_t count = uint32_t(block_arena.size());
+  std::vector<uint32_t> order(count, none);
+  std::vector<uint32_t> low(count, 0);
+  std::vector<bool> on_stack(count, false);
+  std::vector<uint32_t> stack;
+  std::vector<std::pair<uint32_t, int>> frames; // block and next successor to visit
+  std::vector<uint32_t> members;
+  uint32_t counter = 0;
+
+  auto successor = [this](uint32_t block, int which)
+    { return which ? block_arena[block].fallthrough : block_arena[block].taken; };
+
+  auto enter = [&](uint32_t block)
+  {
+    order[block] = low[block] = counter++;
+    stack.push_back(block);
+    on_stack[block] = true;
+    frames.emplace_back(block, 0);
+  };
+
+  for(uint32_t root = 0; root < count; ++root)
+  {
+    if(order[root] != none)
+      continue;
+    enter(root);
+
+    while(!frames.empty())
+    {
+      uint32_t block = frames.back().first;
+      int which = frames.back().second;
+      if(which < 2)
+      {
+        ++frames.back().second;
+        uint32_t other = successor(block, which);
+        if(other == none)
+          continue;
+        if(order[other] == none)
+          enter(other);
+        else if(on_stack[other])
+          low[block] = std::min(low[block], order[other]);
+        continue;
+      }
+
+      frames.pop_back();
+      if(!frames.empty())
+        low[frames.back().first] = std::min(low[frames.back().first], low[block]);
+      if(low[block] != order[block])
+        continue;
+
+      members.clear();
+      uint32_t member;
+      do
+      {
+        member = stack.back();
+        stack.pop_back();
+        on_stack[member] = false;
+        members.push_back(member);
+      } while(member != block);
+
+      if(members.size() > 1 || successor(block, 0) == block || successor(block, 1) == block)
+      {
+        uint32_t loop_index = uint32_t(loop_arena.size());
+        loop current = { *std::min_element(std::begin(members), std::end(members)), uint32_t(members.size()), 0, 0 };
+        for(uint32_t index : members)
+        {
+          block_arena[index].loop = loop_index;
+          current.max_cycles += block_arena[index].max_cycles;
+        }
+        loop_arena.push_back(current);
+      }
+    }
+  }
+
+  // shortest way from each header back to itself
+  std::vector<uint32_t> distance(count, none);
+  using queue_entry = std::pair<uint32_t, uint32_t>; // distance and block
+  std::priority_queue<queue_entry, std::vector<queue_entry>, std::greater<>> queue;
+  for(uint32_t loop_index = 0; loop_index < loop_arena.size(); ++loop_index)
+  {
+    loop& current = loop_arena[loop_index];
+    uint32_t best = none;
+    std::vector<uint32_t> touched;
+    queue.emplace(0, current.header);
+    while(!queue.empty())
+    {
+      auto [cost, block] = queue.top();
+      queue.pop();
+      if(block != current.header && cost > distance[block])
+        continue;
+
+      const basic_block& from = block_arena[block];
+      for(int which = 0; which < 2; ++which)
+      {
+        uint32_t other = successor(block, which);
+        if(other == none || block_arena[other].loop != loop_index)
+          continue;
+        uint32_t next_cost = cost + from.min_cycles + (which ? 0 : from.branch_penalty);
+        if(other == current.header)
+          best = std::min(best, next_cost);
+        else if(next_cost < distance[other])
+        {
+          if(distance[other] == none)
+            touched.push_back(other);
+          distance[other] = next_cost;
+          queue.emplace(next_cost, other);
+        }
+      }
+    }
+    current.min_cycles = best;
+    for(uint32_t block : touched)
+      distance[block] = none;
+  }
+}
+
+void block_estimator::find_hints(const basic_block& block)
+{
+  std::array<uint32_t, 3> window = { none, none, none }; // the last three instructions
+  for(uint32_t pos = block.offset; pos < block.offset + block.size; pos += table[image[pos]].byte_count)
+  {
+    window = { window[1], window[2], pos };
+    const opcode_entry& entry = table[image[pos]];
+    uint16_t address = address_of(pos);
+
+    // absolute addressing of the zero page
+    int zero_page_opcode = zero_page_form[image[pos]];
+    if(zero_page_opcode >= 0)
+    {
+      uint32_t operand = pos + entry.byte_count - 2;
+      uint16_t target = uint16_t(image[operand] | (image[operand + 1] << 8));
+      uint8_t saving = uint8_t(entry.cost.base - table[zero_page_opcode].cost.base);
+      if((target & 0xFF00) == zero_page_base && saving)
+        hint_list.push_back({ pos, address, saving,
+                              std::format("{} ${:04X} can use zero page addressing", entry.mnemonic(), target) });
+    }
+
+    // LDA zp then ORA/AND #bit then STA zp or a branch on the result
+    if(window[0] == none || image[window[0]] != lda_zero_page)
+      continue;
+    uint32_t first = window[0];
+    uint32_t second = window[1];
+    uint8_t zp = image[first + 1];
+    uint8_t mask = image[second + 1];
+    uint8_t third = image[pos];
+    int replacement = -1;
+    std::string text;
+
+    if(image[second] == ora_immediate && single_bit(mask) && third == sta_zero_page && image[pos + 1] == zp)
+    {
+      replacement = smb_forms[std::countr_zero(mask)];
+      text = std::format("LDA/ORA/STA ${:02X} can be SMB{} if A is not needed", zp, std::countr_zero(mask));
+    }
+    else if(image[second] == and_immediate && single_bit(uint8_t(~mask)) && third == sta_zero_page && image[pos + 1] == zp)
+    {
+      replacement = rmb_forms[std::countr_zero(uint8_t(~mask))];
+      text = std::format("LDA/AND/STA ${:02X} can be RMB{} if A is not needed", zp, std::countr_zero(uint8_t(~mask)));
+    }
+    else if(image[second] == and_immediate && single_bit(mask) && (third == beq_relative || third == bne_relative))
+    {
+      replacement = (third == beq_relative ? bbr_forms : bbs_forms)[std::countr_zero(mask)];
+      text = std::format("LDA/AND/{} ${:02X} can be {}{} if A is not needed",
+                         table[third].mnemonic(), zp, third == beq_relative ? "BBR" : "BBS", std::countr_zero(mask));
+    }
+
+    if(replacement >= 0)
+    {
+      uint32_t original = table[image[first]].cost.base + table[image[second]].cost.base + entry.cost.base;
+      if(original > table[replacement].cost.base)
+        hint_list.push_back({ first, address_of(first), uint8_t(original - table[replacement].cost.base), text });
+    }
+  }
+}
+
+void block_estimator::analyse(void)
+{
+  while(!worklist.empty())
+  {
+    uint32_t offset = worklist.back();
+    worklist.pop_back();
+    discover(offset);
+  }
+
+  block_arena.clear();
+  loop_arena.clear();
+  hint_list.clear();
+
+  build_blocks();
+  find_loops();
+  for(const basic_block& block : block_arena)
+    if(block.loop != none)
+      find_hints(block);
+}
@@ -0,0 +1,121 @@
+#ifndef BLOCK_ESTIMATOR_H
+#define BLOCK_ESTIMATOR_H
+
+#include "opcode_table.h"
+
+#include <cstdint>
+#include <array>
+#include <string>
+#include <vector>
+
+// Static basic block and loop cycle estimates for a ROM image.  Code is found by following
+// control flow from the entry points with a worklist.  Each 8KB bank is assumed to stay in
+// the logical slot it was entered through, so jumps and branches that leave that slot are
+// not followed.  Subroutine calls are followed as new entry points and cost only the call
+// itself in the calling block.
+class block_estimator
+{
+public:
+  static constexpr uint32_t none = UINT32_MAX;
+  static constexpr uint32_t bank_size = 0x2000;
+
+  struct basic_block
+  {
+    uint32_t offset;             // image offset of the first instruction
+    uint32_t size;               // in bytes
+    uint16_t address;            // logical address of the first instruction
+    uint16_t instruction_count;
+    uint32_t min_cycles;         // no branch taken
+    uint32_t max_cycles;         // branch taken and decimal mode arithmetic
+    uint8_t branch_penalty;      // extra cycles when the taken successor is followed
+    uint32_t taken;              // successor block indexes or none
+    uint32_t fallthrough;
+    uint32_t loop;               // index of the loop containing this block or none
+  };
+
+  // a strongly connected group of blocks, so nested loops are reported as one
+  struct loop
+  {
+    uint32_t header;             // block index
+    uint32_t block_count;
+    uint32_t min_cycles;         // shortest way around the loop through the header
+    uint32_t max_cycles;         // every block of the loop once with branches taken
+  };
+
+  struct hint
+  {
+    uint32_t offset;             // image offset of the first instruction it replaces
+    uint16_t address;
+    uint8_t saving;              // cycles saved each time it is executed
+    std::string text;
+  };
+
+  block_estimator(const std::vector<uint8_t>& image, isa target = HuC6280);
+
+  // code in the bank holding image offset bank * bank_size is mapped at address & 0xE000
+  void add_entry(uint32_t bank, uint16_t address);
+
+  // the interrupt and reset vectors of bank 0 mapped at $E000
+  void add_vectors(void);
+
+  void analyse(void);
+
+  const std::vector<basic_block>& blocks(void) const { return block_arena; }
+  const std::vector<loop>& loops(void) const { return loop_arena; }
+  const std::vector<hint>& hints(void) const { return hint_list; }
+
+private:
+  enum flow_kind : uint8_t
+  {
+    next,           // continues with the following instruction
+    call,           // JSR and BSR
+    branch,         // conditional, including BBR and BBS
+    jump,           // BRA and JMP with a known target
+    stop,           // returns, BRK, indirect jumps and unassigned opcodes
+  };
+
+  enum byte_state : uint8_t
+  {
+    visited = 0x01, // an instruction starts here
+    leader  = 0x02, // a block starts here
+  };
+
+  void push(uint32_t offset, uint8_t slot);
+  void discover(uint32_t offset);
+  uint32_t target_offset(uint32_t offset, uint16_t target) const;
+  uint16_t address_of(uint32_t offset) const;
+  uint16_t branch_target(uint32_t offset) const;
+  uint32_t block_index(uint32_t offset) const;
+
+  void build_blocks(void);
+  void find_loops(void);
+  void find_hints(const basic_block& block);
+
+  const std::vector<uint8_t>& image;
+  const opcode_table_t& table;
+  uint16_t zero_page_base;
+  std::array<flow_kind, 256> flow;
+  std::array<int, 256> zero_page_form;  // opcode using zero page in place of an absolute address or -1
+
+  // opcodes of the LDA/ORA/STA and LDA/AND/branch hints, -1 where the isa has none
+  int lda_zero_page;
+  int ora_immediate;
+  int and_immediate;
+  int sta_zero_page;
+  int beq_relative;
+  int bne_relative;
+  std::array<int, 8> smb_forms;         // by bit
+  std::array<int, 8> rmb_forms;
+  std::array<int, 8> bbr_forms;
+  std::array<int, 8> bbs_forms;
+
+  std::vector<uint8_t> state;           // byte_state for each image byte
+  std::vector<uint8_t> slots;           // logical slot each instruction was reached through
+  std::vector<uint32_t> worklist;
+
+  std::vector<basic_block> block_arena; // ordered by offset
+  std::vector<loop> loop_arena;
+  std::vector<hint> hint_list;
+};
+
+#endif // BLOCK_ESTIMATOR_H
@@ -0,0 +1,107 @@
+#include <fstream>
+#include <iostream>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+
+#include "block_estimator.h"
+
+using namespace std::literals;
+using namespace std::string_view_literals;
+
+// ----------------------------------------------------------------------------
+
+static std::string cycle_range(uint32_t min_cycles, uint32_t max_cycles)
+{
+  if(min_cycles == max_cycles)
+    return std::to_string(min_cycles);
+  return std::format("{}-{}", min_cycles, max_cycles);
+}
+
+int main (int argc, char** argv)
+{
+  std::ios::sync_with_stdio(false);
+
+  isa target = HuC6280;
+  bool list_blocks = false;
+  std::vector<std::pair<uint32_t, uint16_t>> entries;
+  std::vector<std::string_view> files;
+
+  for(int pos = 1; pos < argc; ++pos)
+  {
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--isa="sv))
+      target = parse_isa(arg.substr("--isa="sv.size()));
+    else if(arg == "--blocks"sv)
+      list_blocks = true;
+    else if(arg.starts_with("--entry="sv))
+    {
+      char* address = nullptr;
+      uint32_t bank = uint32_t(std::strtoul(argv[pos] + "--entry="sv.size(), &address, 16));
+      if(*address != ':')
+        target = None;
+      else
+        entries.emplace_back(bank, uint16_t(std::strtoul(address + 1, nullptr, 16)));
+    }
+    else
+      files.push_back(arg);
+  }
+
+  if(files.size() != 1 || target == None)
+  {
+    std::cerr << "usage: " << argv[0] << " [--isa=HuC6280|WDC65C02|NMOS6502] [--entry=bank:address]... [--blocks] <image>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    std::ifstream fileIn(std::string(files[0]), std::ios::binary);
+    if(!fileIn)
+      throw "unable to open: "s + std::string(files[0]);
+
+    std::vector<uint8_t> image((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+    if(image.size() % block_estimator::bank_size == 512) // copier header
+      image.erase(std::begin(image), std::begin(image) + 512);
+
+    block_estimator estimator(image, target);
+    if(entries.empty())
+      estimator.add_vectors();
+    for(auto [bank, address] : entries)
+      estimator.add_entry(bank, address);
+    estimator.analyse();
+
+    const auto& blocks = estimator.blocks();
+    auto location = [&](uint32_t offset, uint16_t address)
+      { return std::format("{:02X}:{:04X} ${:04X}", offset / block_estimator::bank_size, offset % block_estimator::bank_size, address); };
+
+    std::string output;
+    if(list_blocks)
+      for(const auto& block : blocks)
+        output += std::format("block {}  {:3} instructions  {:>9} cycles\n",
+                              location(block.offset, block.address), block.instruction_count,
+                              cycle_range(block.min_cycles, block.max_cycles));
+
+    for(const auto& current : estimator.loops())
+    {
+      const auto& header = blocks[current.header];
+      output += std::format("loop  {}  {:3} blocks        {:>9} cycles per iteration\n",
+                            location(header.offset, header.address), current.block_count,
+                            cycle_range(current.min_cycles, current.max_cycles));
+    }
+
+    for(const auto& hint : estimator.hints())
+      output += std::format("hint  {}  saves {} cycles: {}\n", location(hint.offset, hint.address), hint.saving, hint.text);
+
+    output += std::format("{} blocks, {} loops, {} hints\n", blocks.size(), estimator.loops().size(), estimator.hints().size());
+    std::cout << output;
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return 0;
+}
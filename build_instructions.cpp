@@ -1,6 +1,31 @@
 #include "build_instructions.h"
 
-void build_insn_blocks (std::list<instructions>& insn_blocks)
+#include "mnemonic_hash.h"
+#include "opcode_table.h"
+
+#include <format>
+
+mode_details::mode_details(isa cpus, uint8_t opcode, abstract abstract_text)
+  : cpus(cpus),
+    opcode(opcode),
+    abstract_string(std::move(abstract_text))
+{
+  // the row of the first cpu, which must run on exactly these cpus
+  int first = std::countr_zero(uint16_t(cpus));
+  uint8_t row_index = first < isa_count ? opcode_row_index[first][opcode] : no_opcode_row;
+  if(row_index == no_opcode_row || opcode_rows[row_index].cpus != cpus)
+    throw std::format("opcode ${:02X} has no opcode_rows entry for cpus {:#x}", opcode, uint16_t(cpus));
+
+  const opcode_row& row = opcode_rows[row_index];
+  byte_count = row.byte_count;
+  mode_data = row.mode_data;
+  if(row.cost() == cycle_cost { row.cycle_count, 0, 0 })
+    cycle_count = int(row.cycle_count);
+  if(mnemonic_family(row.mnemonic))
+    mnemonic_fill_value = row.mnemonic.back() - '0';
+}
+
+void build_insn_blocks (std::vector<instructions>& insn_blocks)
 {
   insn_blocks.assign(
         {
@@ -16,7 +41,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "A branch is always taken; no testing is done. A one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch." },
               summary { "Unconditionally branch to the address calculated from the operand.  The operand is treated as an 8-bit signed number, -128 to 127.  When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction.  For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { WDC65C02 | HuC6280, 0x80, 2, 4, Relative },
+              mode_details { WDC65C02 | HuC6280, 0x80 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -26,11 +51,11 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "" },
               description { "Transfer control to the address specified by the operand field. The program counter is loaded with the target address." },
               summary { "Transfers control(sets the program counter) to the effective address calculated from the operand." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x4C, 3, 4, Absolute, std::nullopt, abstract { "PCL = $ll\nPCH = $hh" } },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x6C, 3, 7, Absolute | Indirect, std::nullopt, abstract { "PCL = [$hhll]\nPCH = [$hhll + 1]" } },
-                { WDC65C02 | HuC6280, 0x7C, 3, 7, Absolute | X_Indexed | Indirect, std::nullopt, abstract { "PCL = [$hhll + X]\nPCH = [$hhll + X + 1]" } },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x4C, abstract { "PCL = $ll\nPCH = $hh" } },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x6C, abstract { "PCL = [$hhll]\nPCH = [$hhll + 1]" } },
+                { WDC65C02 | HuC6280, 0x7C, abstract { "PCL = [$hhll + X]\nPCH = [$hhll + X + 1]" } },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -43,7 +68,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The overflow flag V in the status register is tested. If it is set, a branch is taken; if it is clear, the instruction immediately following the two-byte BVS instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch . BVS is almost exclusively used to check that a two's complement arithmetic calculation has overflowed. Add +2 cycles if branch is taken." },
               summary { "If the Overflow Flag is 1, branch to the address calculated from the operand. The operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x70, 2, { "2 (4 if branch taken)" }, Relative },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x70 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -55,7 +80,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The overflow flag V in the status register is tested. If it is clear, a branch is taken; if it is set, the instruction immediately following the two-byte BVC instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch . BVC is almost exclusively used to check that a two's complement arithmetic calculation has not overflowed. Add +2 cycles if branch is taken." },
               summary { "If the Overflow Flag is 0, branch to the address calculated from the operand. The operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x50, 2, { "2 (4 if branch taken)" }, Relative },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x50 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -67,7 +92,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The carry flag in the status register is tested. If it is set, a branch is taken; if it is clear, the instruction immediately following the two-byte BCS instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch . Note that BCC determines if the result of a comparison is greater than or equal to; therefore, BCC is sometimes written as BGE (Branch if Greater than or Equal). Add +2 cycles if branch is taken." },
               summary { "If the Carry Flag is 1, branch to the address calculated from the operand. The operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xB0, 2, { "2 (4 if branch taken)" }, Relative },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xB0 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -79,7 +104,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The carry flag in the status register is tested. If it is clear, a branch is taken; if it is set, the instruction immediately following the two-byte BCC instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch . Note that BCC determines if the result of a comparison is less than; therefore, BCC is sometimes written as BLT (Branch if Less Than). Add +2 cycles if branch is taken." },
               summary { "If the Carry Flag is 0, branch to the address calculated from the operand. The operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch."},
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x90, 2, { "2 (4 if branch taken)" }, Relative },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x90 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -90,7 +115,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               abstract { "If Z == 1: PC = PC + 2 + REL\nElse: PC = PC + 2" },
               description { "The zero flag in the status register is tested. If it is set, meaning that the last value tested (which affected the zero flag) was zero, a branch is taken; if it is clear, meaning the value tested was non-zero, the instruction immediately following the two-byte BEQ instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch. Add +2 cycles if branch is taken." },
               summary { "If the Zero Flag is 1, branch to the address calculated from the operand. The operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xF0, 2, { "2 (4 if branch taken)" }, Relative },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xF0 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -102,7 +127,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The zero flag in the status register is tested. If it is clear, meaning that the last value tested (which affected the zero flag) was zero, a branch is taken; if it is set, meaning the value tested was non-zero, the instruction immediately following the two-byte BNE instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch. Add +2 cycles if branch is taken." },
               summary { "If the Zero Flag is 0, branch to the address calculated from the operand. The operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xD0, 2, { "2 (4 if branch taken)" }, Relative },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xD0 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -114,7 +139,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The negative flag in the status register is tested. If it is set, meaning the high bit of the value which most recently affected the N flag was set, a branch is taken. Since numbers are often stored in two's complement, this instruction can be used to detect negative numbers. If it is clear, the instruction immediately following the two-byte BMI instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch. Add +2 cycles if branch is taken." },
               summary { "If the Negative Flag is 1, branch to the address calculated from the operand. The operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x30, 2, { "2 (4 if branch taken)" }, Relative },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x30 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -126,7 +151,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The negative flag in the status register is tested. If it is clear, meaning the high bit of the value which most recently affected the N flag was cleared, a branch is taken. Since numbers are often stored in two's complement, this instruction can be used to detect positive numbers. If it is set, the instruction immediately following the two-byte BPL instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch . This opcode takes one extra cycle if the branch is taken, and another extra cycle if a page boundary is crossed in taking the branch." },
               summary { "If the Negative Flag is 0, branch to the address calculated from the operand. The operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x10, 2, { "2 (4 if branch taken)" }, Relative },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x10 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -138,16 +163,16 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The #th bit value in zero page memory location ZZ is tested. If it is clear, a branch is taken; if it is set, the instruction immediately following the three-byte BBRi instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch. Add +2 cycles if branch is taken." },
               summary { "If Bit #n of the value at the effective address specified by the second operand is clear, branch to the address calculated from the second operand. The second operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed second operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { WDC65C02 | HuC6280, 0x0F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 0 },
-                { WDC65C02 | HuC6280, 0x1F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 1 },
-                { WDC65C02 | HuC6280, 0x2F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 2 },
-                { WDC65C02 | HuC6280, 0x3F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 3 },
-                { WDC65C02 | HuC6280, 0x4F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 4 },
-                { WDC65C02 | HuC6280, 0x5F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 5 },
-                { WDC65C02 | HuC6280, 0x6F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 6 },
-                { WDC65C02 | HuC6280, 0x7F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 7 },
+                { WDC65C02 | HuC6280, 0x0F },
+                { WDC65C02 | HuC6280, 0x1F },
+                { WDC65C02 | HuC6280, 0x2F },
+                { WDC65C02 | HuC6280, 0x3F },
+                { WDC65C02 | HuC6280, 0x4F },
+                { WDC65C02 | HuC6280, 0x5F },
+                { WDC65C02 | HuC6280, 0x6F },
+                { WDC65C02 | HuC6280, 0x7F },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -160,16 +185,16 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "The #th bit value in zero page memory location ZZ is tested. If it is set, a branch is taken; if it is clear, the instruction immediately following the three-byte BBSi instruction is executed. If the branch is taken, a one-byte signed displacement, fetched from the third byte of the instruction, is added to the program counter. Once the branch address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the branch. Add +2 cycles if branch is taken." },
               summary { "If Bit #n of the value at the effective address specified by the operand is set, branch to the address calculated from the second operand. The second operand is treated as an 8-bit signed number, -128 to 127. When calculating the branch address, the 8-bit signed second operand is added to the address of the byte immediately following the branch instruction. For example, a branch instruction with an operand of $00 will never branch." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { WDC65C02 | HuC6280, 0x8F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 0 },
-                { WDC65C02 | HuC6280, 0x9F, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 1 },
-                { WDC65C02 | HuC6280, 0xAF, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 2 },
-                { WDC65C02 | HuC6280, 0xBF, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 3 },
-                { WDC65C02 | HuC6280, 0xCF, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 4 },
-                { WDC65C02 | HuC6280, 0xDF, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 5 },
-                { WDC65C02 | HuC6280, 0xEF, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 6 },
-                { WDC65C02 | HuC6280, 0xFF, 3, { "6 (8 if branch taken)" }, ZeroPage | Secondary | Relative, 7 },
+                { WDC65C02 | HuC6280, 0x8F },
+                { WDC65C02 | HuC6280, 0x9F },
+                { WDC65C02 | HuC6280, 0xAF },
+                { WDC65C02 | HuC6280, 0xBF },
+                { WDC65C02 | HuC6280, 0xCF },
+                { WDC65C02 | HuC6280, 0xDF },
+                { WDC65C02 | HuC6280, 0xEF },
+                { WDC65C02 | HuC6280, 0xFF },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -187,7 +212,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "Similar to the Jump to Subroutine (JSR) instruction, Branch to Subroutine allows execution of a subroutine. However, the offset is specified in relative mode instead of as an absolute address. This saves a byte, but takes one more clock cycle than JSR, so its use is discouraged. The current program counter is pushed onto the stack. A one-byte signed displacement, fetched from the second byte of the instruction, is added to the program counter. Once the subroutine address has been calculated, the result is loaded into the program counter, transferring control to that location. The allowable range of the displacement is -128 to +127 from the instruction immediately following the BSR." },
               summary { "The program counter (last byte of the BSR instruction) is pushed to stack and the CPU branches to the specified relative address." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { HuC6280, 0x44, 2, 8, Relative },
+              mode_details { HuC6280, 0x44 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -199,7 +224,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               description { "Transfer control to the subroutine at the location specified by the operand, after first pushing the current program counter value onto the stack as a return address. The value of the PC which is pushed onto the stack is the location of the last (third) byte of the JSR instruction, not the address of the next opcode." },
               summary { "Push the Program Counter onto the stack and set it to the address specified in the second operand." },
               note { "HuC6280: 256-byte and 8192-byte page-boundary crossing do not incur cycle penalties" },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x20, 3, 7, Absolute },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x20 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -209,7 +234,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "" },
               abstract { "SP = SP + 1 ;\tPCL = [SP]\nSP = SP + 1 ;\tPCH = [SP]\nPC = PC + 1" },
               description { "Pull the program counter from the stack, incrementing the 16-bit value by one before loading the program counter with it. The low byte of the program counter is pulled from the stack first, followed by the high byte." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x60, 1, 7, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x60 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
           },
@@ -224,7 +249,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               abstract { "PC = PC + 2\n[SP] = PCH ;\tSP = SP - 1\n[SP] = PCL ;\tSP = SP - 1\n[SP] = P ;\tSP = SP - 1\nPCL = [$FFF6]\nPCH = [$FFF7]" },
               description { "Forces a software interrupt. BRK is unaffected by the I interrupt disable flag. Although BRK is a one-byte instruction, the program counter (which is pushed onto the stack by the instruction) is incremented by two; this lets you follow the break instruction with a one-byte signature byte indicating which break caused the interrupt. Be sure to pad BRK with a single byte to allow an RTI (return from interrupt) instruction to execute correctly. Multiple actions are invoked on a BRK. The program counter is incremented by 2. The high and low bytes of the program counter are pushed onto the stack in order, followed by the status register (P). The program counter is then loaded with the break vector stored at absolute address $00FFF6-$00FFF7. (Remember, the high byte is stored in $00FFF7 and the low byte is stored in $00FFF6.) The decimal flag D is cleared, and the I flag is set (to disable hardware IRQ interrupts) after a break is executed. Additionally, the Break Flag in the status register value pushed onto the stack is set." },
               summary { "Forces a software interrupt using IRQ2's vector. Contrary to IRQs, BRK will push the status flags register with bit 4('B' flag) set."},
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x00, 1, 8, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x00 },
               flags { nullptr, nullptr, 0, 1, 0, 1, nullptr, nullptr },
             },
             instruction
@@ -234,7 +259,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "" },
               abstract { "SP = SP + 1 ;\tP = [SP]\nSP = SP + 1 ;\tPCL = [SP]\nSP = SP + 1 ;\tPCH = [SP]" },
               description { "Pull the status register and the program counter from the stack in order. Normally used to return from an interrupt call (such as BRK), this instruction can also be used to pull the status register P, and the program counter low and high bytes from the stack into the P and program counter registers." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x40, 1, 7, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x40 },
               flags { "[SP]:7", "[SP]:6", "[SP]:5", "[SP]:4", "[SP]:3", "[SP]:2", "[SP]:1", "[SP]:0" },
             },
           },
@@ -249,17 +274,17 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV A, MEM" },
               abstract { "A = MEM" },
               description { "Load the accumulator with the data located at the effective address specified by the operand." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xA9, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xA5, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xB5, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0xB2, 2, 7, ZeroPage | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xA1, 2, 7, ZeroPage | X_Indexed | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xB1, 2, 7, ZeroPage | Indirect | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xAD, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xBD, 3, 5, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xB9, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xA9 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xA5 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xB5 },
+                { WDC65C02 | HuC6280, 0xB2 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xA1 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xB1 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xAD },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xBD },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xB9 },
               },
               flags { "MEM:7", nullptr, 0, nullptr, nullptr, nullptr, "MEM == 0", nullptr },
             },
@@ -270,13 +295,13 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV X, MEM" },
               abstract { "X = MEM" },
               description { "Load the X register with the data located at the effective address specified by the operand." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xA2, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xA6, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xB6, 2, 4, ZeroPage | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xAE, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xBE, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xA2 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xA6 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xB6 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xAE },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xBE },
               },
               flags { "MEM:7", nullptr, 0, nullptr, nullptr, nullptr, "MEM == 0", nullptr },
             },
@@ -287,13 +312,13 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV Y, MEM" },
               abstract { "Y = MEM" },
               description { "Load the Y register with the data located at the effective address specified by the operand." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xA0, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xA4, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xB4, 2, 4, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xAC, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xBC, 3, 5, Absolute | X_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xA0 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xA4 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xB4 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xAC },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xBC },
               },
               flags { "MEM:7", nullptr, 0, nullptr, nullptr, nullptr, "MEM == 0", nullptr },
             },
@@ -304,7 +329,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV [$001FE000], MEM" },
               abstract { "[$001FE000] = IMM" },
               description { "The immediate argument is stored in the HuC6270's address register. This command is equivalent to storing the immediate argument in $1FE000. The HuC6270 No. 0 register is also known as the HuC6270 Address/Status Register; more information is available in the HuC6270 summary. According to the Develo Book , this operation sets /CE7, A1, and A0 to logical LOW." },
-              mode_details { HuC6280, 0x03, 2, 5, Immediate | Implied },
+              mode_details { HuC6280, 0x03 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -314,7 +339,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV [$001FE002], MEM" },
               abstract { "[$001FE002] = IMM" },
               description { "The immediate argument is stored in the HuC6270's low data register. This command is equivalent to storing the immediate argument in $1FE002. The HuC6270 No. 1 register is also known as the HuC6270 Low Data Register; more information is available in the HuC6270 summary. According to the Develo Book , this operation sets /CE7 and A0 to logical LOW, while setting A1 to logical HIGH." },
-              mode_details { HuC6280, 0x13, 2, 5, Immediate | Implied },
+              mode_details { HuC6280, 0x13 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -324,7 +349,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV ST2, MEM" },
               abstract { "[$001FE003] = IMM" },
               description { "The immediate argument is stored in the HuC6270's high data register. This command is equivalent to storing the immediate argument in $1FE003. The HuC6270 No. 2 register is also known as the HuC6270 High Data Register; more information is available in the HuC6270 summary. According to the Develo Book , this operation sets /CE7 to logical LOW, while setting A0 and A1 to logical HIGH." },
-              mode_details { HuC6280, 0x23, 2, 5, Immediate | Implied },
+              mode_details { HuC6280, 0x23 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -334,16 +359,16 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV MEM, A" },
               abstract { "MEM = A" },
               description { "Stores the value in the accumulator to the effective address specified by the operand." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x85, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x95, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0x92, 2, 7, ZeroPage | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x81, 2, 7, ZeroPage | X_Indexed | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x91, 2, 7, ZeroPage | Indirect | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x8D, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x9D, 3, 5, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x99, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x85 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x95 },
+                { WDC65C02 | HuC6280, 0x92 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x81 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x91 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x8D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x9D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x99 },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -354,11 +379,11 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV MEM, X" },
               abstract { "MEM = X" },
               description { "Store the value in the X register to the effective address specified by the operand." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x86, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x96, 2, 4, ZeroPage | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x8E, 3, 5, Absolute },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x86 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x96 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x8E },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -369,11 +394,11 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV MEM, Y" },
               abstract { "MEM = Y" },
               description { "Store the value in the Y register to the effective address specified by the operand." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x84, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x94, 2, 4, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x8C, 3, 5, Absolute },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x84 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x94 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x8C },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -384,7 +409,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV X, SP" },
               abstract { "X = SP" },
               description { "Transfer the value in the stack pointer SP to the X register. The value of the stack pointer is not changed." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xBA, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xBA },
               flags { "SP7", nullptr, 0, nullptr, nullptr, nullptr, "SP == 0", nullptr },
             },
             instruction
@@ -394,7 +419,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV SP, X" },
               abstract { "SP = X" },
               description { "Transfer the value in the X register to the stack pointer. The value of the X register is not changed." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x9A, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x9A },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -404,7 +429,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV A, X" },
               abstract { "A = X" },
               description { "Transfer the value in the X register to the accumulator. The value of the X register is not changed." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x8A, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x8A },
               flags { "X:7", nullptr, 0, nullptr, nullptr, nullptr, "X == 0", nullptr },
             },
             instruction
@@ -414,7 +439,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV X, A" },
               abstract { "X = A" },
               description { "Transfer the value in the accumulator to register X." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xAA, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xAA },
               flags { "A:7", nullptr, 0, nullptr, nullptr, nullptr, "A == 0", nullptr },
             },
             instruction
@@ -424,7 +449,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV A, Y" },
               abstract { "A = Y" },
               description { "Transfer the value in the Y register to the accumulator. The value of the Y register is not changed." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x98, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x98 },
               flags { "Y:7", nullptr, 0, nullptr, nullptr, nullptr, "Y == 0", nullptr },
             },
             instruction
@@ -434,7 +459,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV Y, A" },
               abstract { "Y = A" },
               description { "Transfer the value in the accumulator to register Y." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xA8, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xA8 },
               flags { "A:7", nullptr, 0, nullptr, nullptr, nullptr, "A == 0", nullptr },
             },
             instruction
@@ -445,7 +470,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               abstract { "MPR(IMM) = A" },
               description { "Loads Memory Mapping Register i with the value in the accumulator. More about the MPR registers can be found in the Memory Mapping summary. It is possible to load more than one MPR at a time by setting more than one bit in the immediate argument to TAM." },
               note { "" },
-              mode_details { HuC6280, 0x53, 2, 5, Immediate },
+              mode_details { HuC6280, 0x53 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -456,7 +481,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               abstract { "A = MPR(IMM)" },
               description { "Transfers the value in Memory Mapping Register #$nn to the accumulator. More information about the MPRs can be found on the Memory Mapping summary. Only one bit in the immediate argument can be set to 1." },
               note { "" },
-              mode_details { HuC6280, 0x43, 2, 4, Immediate },
+              mode_details { HuC6280, 0x43 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -466,7 +491,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV A, 0" },
               abstract { "A = 0" },
               description { "The accumulator is set to #$00." },
-              mode_details { HuC6280, 0x62, 1, 2, Implied },
+              mode_details { HuC6280, 0x62 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -476,7 +501,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV X, 0" },
               abstract { "X = 0" },
               description { "The X register is set to #$00." },
-              mode_details { HuC6280, 0x82, 1, 2, Implied },
+              mode_details { HuC6280, 0x82 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -486,7 +511,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV Y, 0" },
               abstract { "Y = 0" },
               description { "The Y register is set to #$00." },
-              mode_details { HuC6280, 0xC2, 1, 2, Implied },
+              mode_details { HuC6280, 0xC2 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -496,12 +521,12 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "MOV MEM, #$00" },
               abstract { "MEM = $00" },
               description { "Store the value 0x00 to the effective address specified by the operand. Very useful for initialising memory." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { WDC65C02 | HuC6280, 0x64, 2, 4, ZeroPage },
-                { WDC65C02 | HuC6280, 0x74, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0x9C, 3, 5, Absolute },
-                { WDC65C02 | HuC6280, 0x9E, 3, 5, Absolute | X_Indexed },
+                { WDC65C02 | HuC6280, 0x64 },
+                { WDC65C02 | HuC6280, 0x74 },
+                { WDC65C02 | HuC6280, 0x9C },
+                { WDC65C02 | HuC6280, 0x9E },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -516,7 +541,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "XCHG X, Y" },
               abstract { "TEMP = X\nX = Y\nY = TEMP" },
               description { "Swaps the values stored in the X and Y registers." },
-              mode_details { HuC6280, 0x02, 1, 3, Implied },
+              mode_details { HuC6280, 0x02 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -526,7 +551,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "XCHG A, X" },
               abstract { "TEMP = A\nA = X\nX = TEMP" },
               description { "The values of the accumulator and the X Register are swapped." },
-              mode_details { HuC6280, 0x22, 1, 3, Implied },
+              mode_details { HuC6280, 0x22 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -536,7 +561,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "XCHG A, Y" },
               abstract { "TEMP = A\nA = Y\nY = TEMP" },
               description { "The values of the accumulator and the Y Register are swapped." },
-              mode_details { HuC6280, 0x42, 1, 3, Implied },
+              mode_details { HuC6280, 0x42 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
           },
@@ -550,7 +575,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "" },
               abstract { "" },
               description { "Execute a memory move where the source address alternates between two addresses, and the destination address increments with each loop cycle. This is an extremely powerful instruction, mainly used for transferring data from the special video memory (e.g., backgrounds, etc.) to the main memory. Blocks interrupts from happening until finished. A/X/Y are pushed onto the stack during the transfer." },
-              mode_details { HuC6280, 0xE3, 7, nullptr, Block },
+              mode_details { HuC6280, 0xF3 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -560,7 +585,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "" },
               abstract { "" },
               description { "Execute a memory move where the source address increments, and the destination address alternates between two addresses with each loop cycle. This is an extremely powerful instruction, mainly used for transferring data to the special video memory (e.g., backgrounds, etc.) from the main memory. Blocks interrupts from happening until finished. A/X/Y are pushed onto the stack during the transfer." },
-              mode_details { HuC6280, 0xE3, 7, nullptr, Block },
+              mode_details { HuC6280, 0xE3 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -570,7 +595,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "" },
               abstract { "" },
               description { "Execute a memory move where the source and destination addresses decrement with each loop cycle. This is an extremely powerful instruction, mainly used for copying and moving data around in main memory. Blocks interrupts from happening until finished. A/X/Y are pushed onto the stack during the transfer." },
-              mode_details { HuC6280, 0xC3, 7, nullptr, Block },
+              mode_details { HuC6280, 0xC3 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -580,7 +605,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "" },
               abstract { "" },
               description { "Execute a memory move where the source address increments with each loop cycle. This is an extremely powerful instruction, mainly used for transferring data to byte wide ports (e.g., PSG, etc.) to the main memory. Blocks interrupts from happening until finished. A/X/Y are pushed onto the stack during the transfer." },
-              mode_details { HuC6280, 0xD3, 7, nullptr, Block },
+              mode_details { HuC6280, 0xD3 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -590,7 +615,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
               llvm_syntax { "" },
               abstract { "" },
               description { "Execute a memory move where the source and destination addresses increment with each loop cycle. This is an extremely powerful instruction, mainly used for copying and moving blocks of data around in main memory. Blocks interrupts from happening until finished. A/X/Y are pushed onto the stack during the transfer." },
-              mode_details { HuC6280, 0xD3, 7, nullptr, Block },
+              mode_details { HuC6280, 0x73 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
           },
@@ -609,7 +634,7 @@ void build_insn_blocks (std::list<instructions>& insn_blocks)
 R"(The Decimal Mode Flag is also known as D and P3.
 When set, the ADC and SBC instructions will utilized Packed BCD arithmetic.)"
               },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xF8, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xF8 },
               flags { nullptr, nullptr, 0, nullptr, 1, nullptr, nullptr, nullptr },
             },
             instruction
@@ -624,7 +649,7 @@ When set, the ADC and SBC instructions will utilized Packed BCD arithmetic.)"
 R"(The Decimal Mode Flag is also known as D and P3.
 When reset, the ADC and SBC instructions will return to using binary arithmetic.)"
               },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xD8, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xD8 },
               flags { nullptr, nullptr, 0, nullptr, 0, nullptr, nullptr, nullptr },
             },
             instruction
@@ -636,7 +661,7 @@ When reset, the ADC and SBC instructions will return to using binary arithmetic.
               description { "The carry flag C in the status register is set to 1." },
               summary { "Sets the Carry Flag to 1." },
               note { "The Carry Flag is also known as C and P0." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x38, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x38 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, 1 },
             },
             instruction
@@ -648,7 +673,7 @@ When reset, the ADC and SBC instructions will return to using binary arithmetic.
               description { "The carry flag C in the status register is set to 0." },
               summary { "Resets the Carry Flag, known also as C and P0, to 0." },
               note { "The Carry Flag is also known as C and P0." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x18, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x18 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, 0 },
             },
             instruction
@@ -660,7 +685,7 @@ When reset, the ADC and SBC instructions will return to using binary arithmetic.
               description { "The interrupt disable flag I in the status register is set to 1. This disables hardware interrupt processing." },
               summary { "Sets the Interrupt Disable Flag to 1. This prevents hardware IRQs from being processed." },
               note { "The Interrupt Disable Flag is also known as I and P2.\nThis will only prevent IRQs after the next instruction is executed." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x78, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x78 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, 1, nullptr, nullptr },
             },
             instruction
@@ -672,7 +697,7 @@ When reset, the ADC and SBC instructions will return to using binary arithmetic.
               description { "The interrupt disable flag I in the status register is set to 0. This re-enables hardware interrupt (IRQ) processing." },
               summary { "Resets the Interrupt Disable Flag to 0. This enables hardware IRQ processing."},
               note { "The Interrupt Disable Flag is also known as I and P2.\nThis will only allow IRQs after the next instruction is executed." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x58, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x58 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, 0, nullptr, nullptr },
             },
             instruction
@@ -684,7 +709,7 @@ When reset, the ADC and SBC instructions will return to using binary arithmetic.
               description { "The T flag in the status register is set to 1. The T flag is called the \"Memory Operation Flag;\", when this flag is set all the instructions that normally use the A register act differently, I don't know exactly if all the instructions are affected but I'm sure for AND, EOR, OR & ADC. In place of using the A register the instruction use the memory location in ZP pointed by the X register, so for example if you use SET followed by ADC #10, the CPU will do ZP[X] = ZP[X] + 10. When the T flag is set, operations that work under the T flag will have a Read-Modify-Write +1 penalty." },
               summary { "Sets the Memory Transfer Flag to 1." },
               note { "The Memory Transfer Flag is also known as T and P5.\nThis instruction should only be used immediately before ADC, SBC, AND, ORA, or EOR." },
-              mode_details { HuC6280, 0xF4, 1, 2, Implied },
+              mode_details { HuC6280, 0xF4 },
               flags { nullptr, nullptr, 1, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -703,7 +728,7 @@ The Overflow Flag cannot be set directly.
 * BIT, TRB, TSB, and TST will load M6 into the Overflow Flag.
 * PLP and RTI will restore the Overflow Flag from stack)"
               },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xB8, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xB8 },
               flags { nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
           },
@@ -718,16 +743,16 @@ The Overflow Flag cannot be set directly.
               abstract { "MEM#n = 1" },
               description { "Set the specified bit in the zero page memory location specified in the operand. The bit to clear is specified by a number concatenated to the end of the mnemonic, resulting in 8 distinct Opcodes." },
               summary { "Reads the zero-page address specified by the operand, sets the bit #n, and then writes it back to the aforementioned address." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { WDC65C02 | HuC6280, 0x87, 2, 7, ZeroPage, 0 },
-                { WDC65C02 | HuC6280, 0x97, 2, 7, ZeroPage, 1 },
-                { WDC65C02 | HuC6280, 0xA7, 2, 7, ZeroPage, 2 },
-                { WDC65C02 | HuC6280, 0xB7, 2, 7, ZeroPage, 3 },
-                { WDC65C02 | HuC6280, 0xC7, 2, 7, ZeroPage, 4 },
-                { WDC65C02 | HuC6280, 0xD7, 2, 7, ZeroPage, 5 },
-                { WDC65C02 | HuC6280, 0xE7, 2, 7, ZeroPage, 6 },
-                { WDC65C02 | HuC6280, 0xF7, 2, 7, ZeroPage, 7 },
+                { WDC65C02 | HuC6280, 0x87 },
+                { WDC65C02 | HuC6280, 0x97 },
+                { WDC65C02 | HuC6280, 0xA7 },
+                { WDC65C02 | HuC6280, 0xB7 },
+                { WDC65C02 | HuC6280, 0xC7 },
+                { WDC65C02 | HuC6280, 0xD7 },
+                { WDC65C02 | HuC6280, 0xE7 },
+                { WDC65C02 | HuC6280, 0xF7 },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -739,16 +764,16 @@ The Overflow Flag cannot be set directly.
               abstract { "MEM#n = 0" },
               description { "Clear the specified bit in the zero page memory location specified in the operand. The bit to clear is specified by a number concatenated to the end of the mnemonic, resulting in 8 distinct Opcodes." },
               summary { "Reads the zero-page address specified by the operand, resets(clears) the bit #n, and then writes it back to the aforementioned address." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { WDC65C02 | HuC6280, 0x07, 2, 7, ZeroPage, 0 },
-                { WDC65C02 | HuC6280, 0x17, 2, 7, ZeroPage, 1 },
-                { WDC65C02 | HuC6280, 0x27, 2, 7, ZeroPage, 2 },
-                { WDC65C02 | HuC6280, 0x37, 2, 7, ZeroPage, 3 },
-                { WDC65C02 | HuC6280, 0x47, 2, 7, ZeroPage, 4 },
-                { WDC65C02 | HuC6280, 0x57, 2, 7, ZeroPage, 5 },
-                { WDC65C02 | HuC6280, 0x67, 2, 7, ZeroPage, 6 },
-                { WDC65C02 | HuC6280, 0x77, 2, 7, ZeroPage, 7 },
+                { WDC65C02 | HuC6280, 0x07 },
+                { WDC65C02 | HuC6280, 0x17 },
+                { WDC65C02 | HuC6280, 0x27 },
+                { WDC65C02 | HuC6280, 0x37 },
+                { WDC65C02 | HuC6280, 0x47 },
+                { WDC65C02 | HuC6280, 0x57 },
+                { WDC65C02 | HuC6280, 0x67 },
+                { WDC65C02 | HuC6280, 0x77 },
               },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
@@ -764,7 +789,7 @@ The Overflow Flag cannot be set directly.
               llvm_syntax { "PUSH A" },
               abstract { "SP = SP + 1 ;\t[SP] = A" },
               description { "Push the accumulator onto the stack." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x48, 1, 3, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x48 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -774,7 +799,7 @@ The Overflow Flag cannot be set directly.
               llvm_syntax { "PUSH P" },
               abstract { "SP = SP + 1 ;\t[SP] = P" },
               description { "Push the process status register P onto the stack." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x08, 1, 3, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x08 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -784,7 +809,7 @@ The Overflow Flag cannot be set directly.
               llvm_syntax { "PUSH X" },
               abstract { "SP = SP + 1 ;\t[SP] = X" },
               description { "Push the X register onto the stack." },
-              mode_details { WDC65C02 | HuC6280, 0xDA, 1, 3, Implied },
+              mode_details { WDC65C02 | HuC6280, 0xDA },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -794,7 +819,7 @@ The Overflow Flag cannot be set directly.
               llvm_syntax { "PUSH Y" },
               abstract { "SP = SP + 1 ;\t[SP] = Y" },
               description { "Push the Y register onto the stack." },
-              mode_details { WDC65C02 | HuC6280, 0x5A, 1, 3, Implied },
+              mode_details { WDC65C02 | HuC6280, 0x5A },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -804,7 +829,7 @@ The Overflow Flag cannot be set directly.
               llvm_syntax { "POP A" },
               abstract { "A = [SP]\nSP = SP - 1" },
               description { "Pull the value on the top of the stack into the accumulator. The previous contents of the accumulator are destroyed." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x68, 1, 4, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x68 },
               flags { "[SP]:7", nullptr, 0, nullptr, nullptr, nullptr, "[SP] == 0", nullptr },
             },
             instruction
@@ -814,7 +839,7 @@ The Overflow Flag cannot be set directly.
               llvm_syntax { "POP P" },
               abstract { "P = [SP]\nSP = SP - 1" },
               description { "Pull the value on the top of the stack into the processor status register P. The previous contents of the status register are destroyed." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x28, 1, 4, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x28 },
               flags { "P7", "P6", "P5", "P4", "P3", "P2", "P1", "P0" },
             },
             instruction
@@ -824,7 +849,7 @@ The Overflow Flag cannot be set directly.
               llvm_syntax { "POP X" },
               abstract { "X = [SP]\nSP = SP - 1" },
               description { "Pull the value on the top of the stack into the X register. The previous contents of the X register are destroyed." },
-              mode_details { WDC65C02 | HuC6280, 0xFA, 1, 4, Implied },
+              mode_details { WDC65C02 | HuC6280, 0xFA },
               flags { "[SP]:7", nullptr, 0, nullptr, nullptr, nullptr, "[SP] == 0", nullptr },
             },
             instruction
@@ -834,7 +859,7 @@ The Overflow Flag cannot be set directly.
               llvm_syntax { "POP Y" },
               abstract { "Y = [SP]\nSP = SP - 1" },
               description { "Pull the value on the top of the stack into the Y register. The previous contents of the Y register are destroyed." },
-              mode_details { WDC65C02 | HuC6280, 0x7A, 1, 4, Implied },
+              mode_details { WDC65C02 | HuC6280, 0x7A },
               flags { "[SP]:7", nullptr, 0, nullptr, nullptr, nullptr, "[SP] == 0", nullptr },
             },
           },
@@ -854,17 +879,17 @@ If the Decimal-mode CPU flag is set, an extra cycle will be taken(*confirmed wit
 The overflow flag is not affected by this instruction if in Decimal mode; otherwise, if bit 7 of the result != bit 7 of the accumulator before the operation, and bit 7 of the accumulator before the operation == bit 7 of the value specified by the operand, the overflow flag is set, otherwise it is cleared. In other words, if we were to treat the accumulator and value specified by the operand as two's complement numbers, in the range of -128 to 127, the overflow flag will be set if the end result is outside of this range(otherwise it will be cleared).
 If T=1 (the previous instruction is SET) the zero-page byte specified by the X register is used instead of the A register.)"
               },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x69, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x65, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x75, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0x72, 2, 7, ZeroPage | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x61, 2, 7, ZeroPage | X_Indexed | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x71, 2, 7, ZeroPage | Indirect | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x6D, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x7D, 3, 5, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x79, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x69 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x65 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x75 },
+                { WDC65C02 | HuC6280, 0x72 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x61 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x71 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x6D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x7D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x79 },
               },
               flags { "A + MEM > 127", "V*", 0, nullptr, nullptr, nullptr, "(A == 0) && (MEM == 0)", "C" },
             },
@@ -875,17 +900,17 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "If T == 0: A = A - MEM\nElse: MEM = A - MEM" },
               description { "Subtract the data located at the effective address specified by the operand to the contents of the accumulator. Subtract one more from the result if the carry flag is set, and store the final result in the accumulator. This opcode takes one extra cycle if the decimal mode flag D is set." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xE9, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xE5, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xF5, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0xF2, 2, 7, ZeroPage | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xE1, 2, 7, ZeroPage | X_Indexed | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xF1, 2, 7, ZeroPage | Indirect | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xED, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xFD, 3, 5, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xF9, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xE9 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xE5 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xF5 },
+                { WDC65C02 | HuC6280, 0xF2 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xE1 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xF1 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xED },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xFD },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xF9 },
               },
               flags { "A - MEM > 127", "V*", 0, nullptr, nullptr, nullptr, "A == MEM", "A >= MEM" },
             },
@@ -897,17 +922,17 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               abstract { "If T == 0: A = A & MEM\nElse: MEM = A & MEM" },
               description { "Bitwise AND the data located at the effective address specified by the operand with the contents of the accumulator. Each bit in the accumulator is ANDed with the corresponding bit in memory, with the result being stored in the respective accumulator bit." },
               summary { "Performs a bit-by-bit logical and on the accumulator with the value specified by the operand." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x29, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x25, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x35, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0x32, 2, 7, ZeroPage | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x21, 2, 7, ZeroPage | X_Indexed | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x31, 2, 7, ZeroPage | Indirect | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x2D, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x3D, 3, 5, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x39, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x29 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x25 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x35 },
+                { WDC65C02 | HuC6280, 0x32 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x21 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x31 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x2D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x3D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x39 },
               },
               flags { "A:7 & MEM:7", nullptr, 0, nullptr, nullptr, nullptr, "A & MEM == 0", nullptr },
             },
@@ -918,17 +943,17 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "If T == 0: A = A | MEM\nElse: MEM = A | MEM" },
               description { "Bitwise OR the data located at the effective address specified by the operand with the contents of the accumulator. Each bit in the accumulator is ORed with the corresponding bit in memory, with the result being stored in the respective accumulator bit." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x09, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x05, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x15, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0x12, 2, 7, ZeroPage | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x01, 2, 7, ZeroPage | X_Indexed | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x11, 2, 7, ZeroPage | Indirect | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x0D, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x1D, 3, 5, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x19, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x09 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x05 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x15 },
+                { WDC65C02 | HuC6280, 0x12 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x01 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x11 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x0D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x1D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x19 },
               },
               flags { "A:7 | MEM:7", nullptr, 0, nullptr, nullptr, nullptr, "A | MEM == 0", nullptr },
             },
@@ -939,17 +964,17 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "If T == 0: A = A ^ MEM\nElse: MEM = A ^ MEM" },
               description { "Bitwise Exclusive OR the data located at the effective address specified by the operand with the contents of the accumulator. Each bit in the accumulator is XORed with the corresponding bit in memory, with the result being stored in the respective accumulator bit." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x49, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x45, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x55, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0x52, 2, 7, ZeroPage | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x41, 2, 7, ZeroPage | X_Indexed | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x51, 2, 7, ZeroPage | Indirect | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x4D, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x5D, 3, 5, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x59, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x49 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x45 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x55 },
+                { WDC65C02 | HuC6280, 0x52 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x41 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x51 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x4D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x5D },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x59 },
               },
               flags { "A ^ MEM > 127", nullptr, 0, nullptr, nullptr, nullptr, "A ^ MEM == 0", nullptr },
             },
@@ -965,13 +990,13 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               abstract { "C = MEM:7\nMEM = MEM << 1" },
               description { "Shift the contents of the location specified by the operand left one bit. That is, bit one takes on the value originally found in bit zero, bit two takes the value originally in bit one, and so on; bit 7 is transferred into the carry flag; bit 0 is cleared. The arithmetic result of the operation is an unsigned multiplication by two." },
               summary { "Shifts the value at the location specified by the operand left by one bit, shifting in 0 to bit 0, and writes the result back to that location. Bit 7 of the value before the shift is copied to the Carry flag." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x06, 2, 6, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x16, 2, 6, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x0E, 3, 7, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x1E, 3, 7, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x0A, 1, 2, Accumulator },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x06 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x16 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x0E },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x1E },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x0A },
               },
               flags { "MEM:6", nullptr, 0, nullptr, nullptr, nullptr, "MEM & 0b01111111 == 0", "MEM:7" },
             },
@@ -982,13 +1007,13 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "TEMPBIT = MEM:7\nMEM = MEM << 1\nMEM:0 = C\nC = TEMPBIT" },
               description { "Rotate the contents of the location specified by the operand left one bit. That is, bit one takes on the value originally found in bit zero, bit two takes the value originally in bit one, and so on; bit 0 takes on the value in the carry flag; bit 7 is transferred into the carry." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x26, 2, 6, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x36, 2, 6, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x2E, 3, 7, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x3E, 3, 7, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x2A, 1, 2, Accumulator },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x26 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x36 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x2E },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x3E },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x2A },
               },
               flags { "MEM:6", nullptr, 0, nullptr, nullptr, nullptr, "(MEM & 0b01111111 == 0) && (C == 0)", "MEM:7" },
             },
@@ -999,13 +1024,13 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "C = MEM:0\nMEM = MEM >> 1" },
               description { "Logical shift the contents of the location specified by the operand right one bit. That is, bit zero takes on the value originally found in bit one, bit one takes the value originally in bit two, and so on; bit 7 is cleared; bit 0 is transferred into the carry flag. The arithmetic result of the operation is an unsigned division by two." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x46, 2, 6, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x56, 2, 6, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x4E, 3, 7, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x5E, 3, 7, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x4A, 1, 2, Accumulator },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x46 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x56 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x4E },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x5E },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x4A },
               },
               flags { 0, nullptr, 0, nullptr, nullptr, nullptr, "MEM & 0b11111110 == 0", "MEM:0" },
             },
@@ -1016,13 +1041,13 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "TEMPBIT = MEM:0\nMEM = MEM >> 1\nMEM:7 = C\nC = TEMPBIT" },
               description { "Rotate the contents of the location specified by the operand right one bit. That is, bit zero takes on the value originally found in bit one, bit one takes the value originally in bit two, and so on; bit 7 takes on the value in the carry flag; bit 0 is transferred into the carry." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0x66, 2, 6, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x76, 2, 6, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x6E, 3, 7, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x7E, 3, 7, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x6A, 1, 2, Accumulator },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x66 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x76 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x6E },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x7E },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x6A },
               },
               flags { "C == 1", nullptr, 0, nullptr, nullptr, nullptr, "(MEM & 0b11111110 == 0) && (C == 0)", "MEM:0" },
             },
@@ -1037,13 +1062,13 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "DEC MEM" },
               abstract { "MEM = MEM - 1" },
               description { "Decrement by one the contents of the location specified by the operand (subtract one from the value). DEC neither affects nor is affected by the carry flag." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xC6, 2, 6, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xD6, 2, 6, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xCE, 3, 7, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xDE, 3, 7, Absolute | X_Indexed },
-                { WDC65C02 | HuC6280, 0x3A, 1, 2, Accumulator },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xC6 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xD6 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xCE },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xDE },
+                { WDC65C02 | HuC6280, 0x3A },
               },
               flags { "MEM - 1 > 127", nullptr, 0, nullptr, nullptr, nullptr, "MEM - 1 == 0", nullptr },
             },
@@ -1054,7 +1079,7 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "DEC X" },
               abstract { "X = X - 1" },
               description { "Decrement by one the contents of the X register (subtract one from the value). DEX neither affects nor is affected by the carry flag." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xCA, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xCA },
               flags { "X - 1 > 127", nullptr, 0, nullptr, nullptr, nullptr, "X - 1 == 0", nullptr },
             },
             instruction
@@ -1064,7 +1089,7 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "DEC Y" },
               abstract { "Y = Y - 1" },
               description { "Decrement by one the contents of the Y register (subtract one from the value). DEY neither affects nor is affected by the carry flag." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x88, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0x88 },
               flags { "Y - 1 > 127", nullptr, 0, nullptr, nullptr, nullptr, "Y - 1 == 0", nullptr },
             },
             instruction
@@ -1074,13 +1099,13 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "INC MEM" },
               abstract { "MEM = MEM + 1" },
               description { "Increments contents of the location specified by the operand (add one to the value). INC neither affects nor is affected by the carry flag." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xE6, 2, 6, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xF6, 2, 6, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xEE, 3, 7, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xFE, 3, 7, Absolute | X_Indexed },
-                { WDC65C02 | HuC6280, 0x1A, 1, 2, Accumulator },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xE6 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xF6 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xEE },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xFE },
+                { WDC65C02 | HuC6280, 0x1A },
               },
               flags { "MEM + 1 > 127", nullptr, 0, nullptr, nullptr, nullptr, "MEM + 1 == 0", nullptr },
             },
@@ -1093,7 +1118,7 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               description { "Increment by one contents of the X register (add one to the value). INX neither affects nor is affected by the carry flag." },
               summary { "Increments the value in the X register by one." },
               note { "The Carry Flag is not used, nor is it modified." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xE8, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xE8 },
               flags { "X + 1 > 127", nullptr, 0, nullptr, nullptr, nullptr, "X + 1 == 0", nullptr },
             },
             instruction
@@ -1105,7 +1130,7 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               description { "Increment by one contents of the Y register (add one to the value). INY neither affects nor is affected by the carry flag." },
               summary { "Increments the value in the Y register by one." },
               note { "The Carry Flag is not used, nor is it modified." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xC8, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xC8 },
               flags { "Y + 1 > 127", nullptr, 0, nullptr, nullptr, nullptr, "Y + 1 == 0", nullptr },
             },
           },
@@ -1120,17 +1145,17 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "CMP A, MEM" },
               abstract { "A - MEM (result discarded)" },
               description { "Subtract the data located at the effective address specified by the operand from the contents of the accumulator, setting the carry, zero, and negative flags based on the result, but without altering the contents of either the memory location or the accumulator. The comparison is of unsigned binary values only (decimal mode is ignored), and the result is not saved." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xC9, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xC5, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xD5, 2, 4, ZeroPage | X_Indexed },
-                { WDC65C02 | HuC6280, 0xD2, 2, 7, ZeroPage | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xC1, 2, 7, ZeroPage | X_Indexed | Indirect },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xD1, 2, 7, ZeroPage | Indirect | Y_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xCD, 3, 5, Absolute },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xDD, 3, 5, Absolute | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xD9, 3, 5, Absolute | Y_Indexed },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xC9 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xC5 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xD5 },
+                { WDC65C02 | HuC6280, 0xD2 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xC1 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xD1 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xCD },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xDD },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xD9 },
               },
               flags { "A - MEM > 127", nullptr, 0, nullptr, nullptr, nullptr, "A == MEM", "A >= MEM" },
             },
@@ -1141,11 +1166,11 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "CMP X, MEM" },
               abstract { "X - MEM (result discarded)" },
               description { "Subtract the data located at the effective address specified by the operand from the contents of the X register, setting the carry, zero, and negative flags based on the result, but without altering the contents of either the memory location or the accumulator. The comparison is of unsigned binary values only (decimal mode is ignored), and the result is not saved." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xE0, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xE4, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xEC, 3, 5, Absolute },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xE0 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xE4 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xEC },
               },
               flags { "X - MEM > 127", nullptr, 0, nullptr, nullptr, nullptr, "X == MEM", "X >= MEM" },
             },
@@ -1156,11 +1181,11 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "CMP Y, MEM" },
               abstract { "Y - MEM (result discarded)" },
               description { "Subtract the data located at the effective address specified by the operand from the contents of the Y register, setting the carry, zero, and negative flags based on the result, but without altering the contents of either the memory location or the accumulator. The comparison is of unsigned binary values only (decimal mode is ignored), and the result is not saved." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { NMOS6502 | WDC65C02 | HuC6280, 0xC0, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xC4, 2, 4, ZeroPage },
-                { NMOS6502 | WDC65C02 | HuC6280, 0xCC, 3, 5, Absolute },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xC0 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xC4 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0xCC },
               },
               flags { "Y - MEM > 127", nullptr, 0, nullptr, nullptr, nullptr, "Y == MEM", "Y >= MEM" },
             },
@@ -1175,13 +1200,13 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "A & MEM (result discarded)" },
               description { "BIT sets the status register flags based on the result of two different operations. First, it sets or clears the N flag to reflect the value of the high bit (bit 7) of the data located at the effective address specified by the operand, and sets or clears the V flag to reflect the contents of the next-to-highest bit (bit 6) of the data addressed. Second, it logically ANDs the data located at the effective address with the contents of the accumulator; it changes neither value, but sets the Z flag if the result is zero, or clears it if the result is non-zero." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { WDC65C02 | HuC6280, 0x89, 2, 2, Immediate },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x24, 2, 4, ZeroPage },
-                { WDC65C02 | HuC6280, 0x34, 2, 4, ZeroPage | X_Indexed },
-                { NMOS6502 | WDC65C02 | HuC6280, 0x2C, 3, 5, Absolute },
-                { WDC65C02 | HuC6280, 0x3C, 3, 5, Absolute | X_Indexed },
+                { WDC65C02 | HuC6280, 0x89 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x24 },
+                { WDC65C02 | HuC6280, 0x34 },
+                { NMOS6502 | WDC65C02 | HuC6280, 0x2C },
+                { WDC65C02 | HuC6280, 0x3C },
               },
               flags { "MEM:7", "MEM:6", 0, nullptr, nullptr, nullptr, "A & MEM == 0", nullptr },
             },
@@ -1192,10 +1217,10 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "MEM = MEM & ~A" },
               description { "Logically AND together the complement of the value in the accumulator with the data at the effective address specified by the operand. Store the result at the memory location. This clears each bit for which the corresponding accumulator bit is set, making it an ideal opcode for masking data. N and V and Z are set as in the BIT opcode instruction. These flags are set based on the ANDing of the uncomplemented accumulator value with the memory value." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { WDC65C02 | HuC6280, 0x14, 2, 6, ZeroPage },
-                { WDC65C02 | HuC6280, 0x1C, 3, 7, Absolute },
+                { WDC65C02 | HuC6280, 0x14 },
+                { WDC65C02 | HuC6280, 0x1C },
               },
               flags { "MEM:7", "MEM:6", 0, nullptr, nullptr, nullptr, "A & MEM == 0", nullptr },
             },
@@ -1206,10 +1231,10 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "MEM = MEM | ~A" },
               description { "Logically OR together the value in the accumulator with the data at the effective address specified by the operand. Store the result at the memory location. This sets each bit for which the corresponding accumulator bit is set, making it an ideal opcode for masking data. N and V and Z are set as in the BIT opcode instruction. These flags are set based on the ANDing of the accumulator value with the memory value." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { WDC65C02 | HuC6280, 0x04, 2, 6, ZeroPage },
-                { WDC65C02 | HuC6280, 0x0C, 3, 7, Absolute },
+                { WDC65C02 | HuC6280, 0x04 },
+                { WDC65C02 | HuC6280, 0x0C },
               },
               flags { "A:7 | MEM:7", "A:6 | MEM:6", 0, nullptr, nullptr, nullptr, "A | MEM == 0", nullptr },
             },
@@ -1220,12 +1245,12 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "IMM & MEM (result discarded)" },
               description { "Logically AND together the immediate operand with the data at the effective address specified by the operand. This sets each bit for which the corresponding immediate argument bit is set, making it an ideal opcode for masking data. N and V and Z are set as in the BIT opcode instruction." },
-              std::list<mode_details>
+              std::vector<mode_details>
               {
-                { HuC6280, 0x83, 3, 7, Immediate | Secondary | ZeroPage },
-                { HuC6280, 0xA3, 3, 7, Immediate | Secondary | ZeroPage | X_Indexed },
-                { HuC6280, 0x93, 4, 8, Immediate | Secondary | Absolute },
-                { HuC6280, 0xB3, 4, 8, Immediate | Secondary | Absolute | X_Indexed },
+                { HuC6280, 0x83 },
+                { HuC6280, 0xA3 },
+                { HuC6280, 0x93 },
+                { HuC6280, 0xB3 },
               },
               flags { "MEM:7", "MEM:6", 0, nullptr, nullptr, nullptr, "IMM & MEM == 0", nullptr },
             },
@@ -1240,7 +1265,7 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "NOP" },
               abstract { "PC = PC + 1" },
               description { "NOP performs no action, and is often used for timing loops or temporarily removing certain instructions." },
-              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xEA, 1, 2, Implied },
+              mode_details { NMOS6502 | WDC65C02 | HuC6280, 0xEA },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -1250,7 +1275,7 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "Run CPU at 100% speed (7.15909 MHz)" },
               description { "Sets the HuC6280 to \"high speed,\" or normal speed mode. Used for switching the processor back into high-speed mode." },
-              mode_details { HuC6280, 0xD4, 1, 3, Implied },
+              mode_details { HuC6280, 0xD4 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
             instruction
@@ -1260,7 +1285,7 @@ If T=1 (the previous instruction is SET) the zero-page byte specified by the X r
               llvm_syntax { "" },
               abstract { "Run CPU at 25% speed (1.7897725 MHz)" },
               description { "Sets the HuC6280 to low speed. Need for accessing slow memory. The CD bios routines, and some hucards, use this for accessing BRAM." },
-              mode_details { HuC6280, 0x54, 1, 3, Implied },
+              mode_details { HuC6280, 0x54 },
               flags { nullptr, nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr },
             },
           }
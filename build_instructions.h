@@ -2,7 +2,8 @@
 
 #include <cstdint>
 #include <string>
-#include <list>
+#include <string_view>
+#include <vector>
 #include <optional>
 #include <variant>
 #include <tuple>
@@ -34,6 +35,17 @@ constexpr isa operator |(isa a, isa b)
 
 constexpr const int isa_count = 3;
 
+// by isa bit, as the tools take them with --isa=
+constexpr std::array<std::string_view, isa_count> isa_names = { "NMOS6502", "WDC65C02", "HuC6280" };
+
+constexpr isa parse_isa(std::string_view name)
+{
+  for(std::size_t bit = 0; bit < isa_names.size(); ++bit)
+    if(name == isa_names[bit])
+      return isa(1 << bit);
+  return None;
+}
+
 struct isa_property : std::array<std::string, isa_count>
 {
   using parent = std::array<std::string, isa_count>;
@@ -97,20 +109,28 @@ using flags = std::array<snn_t, 8>;
 
 struct mode_details
 {
-  isa cpus;
-  int opcode;
-  int byte_count;
-  snn_t cycle_count;
-  modes_t mode_data;
+  mode_details(void) = default;
+
+  // the byte count, cycles, modes and "#" fill value of the opcode_rows entry of opcode on cpus
+  mode_details(isa cpus, uint8_t opcode, abstract abstract_text = {});
+
+  isa cpus = None;
+  int opcode = 0;
+  int byte_count = 0;
+  snn_t cycle_count = nullptr;    // text from cycle_string() when it is not a plain count
+  modes_t mode_data = modes_t(0);
   std::optional<int> mnemonic_fill_value = std::nullopt;
   abstract abstract_string = {};
   pceas_syntax pceas_syntax_string = {};
   llvm_syntax  llvm_syntax_string = {};
   machine_code machine = {};
-  description description_string = {};
-  summary summary_string = {};
-  name name_string = {};
   mode_string address_mode_string = {};
+  uint32_t parent = 0;            // index of the owning instruction in its section
+
+  // interned, so rows of the same instruction share one copy
+  std::string_view description_string = {};
+  std::string_view summary_string = {};
+  std::string_view name_string = {};
 };
 
 struct instruction
@@ -138,7 +158,7 @@ struct instruction
               llvm_syntax,
               abstract,
               mode_details,
-              std::list<mode_details>,
+              std::vector<mode_details>,
               note,
               flags> details =
   {
@@ -150,22 +170,25 @@ struct instruction
     llvm_syntax(),
     abstract(),
     mode_details(),
-    std::list<mode_details>(),
+    std::vector<mode_details>(),
     note(),
     flags(),
   };
 };
 
-struct instructions : public std::list<instruction>
+struct instructions : public std::vector<instruction>
 {
   template <typename... Args>
   instructions (const char* title, const Args&... args)
-    : std::list<instruction>(std::initializer_list<instruction>{ args... })
+    : std::vector<instruction>(std::initializer_list<instruction>{ args... })
   { section_title = title; }
 
+  const instruction& parent_of(const mode_details& md) const
+    { return (*this)[md.parent]; }
+
   const char* section_title;
 };
 
 // ----------------------------------------------------------------------------
 
-void build_insn_blocks(std::list<instructions>& insn_blocks);
+void build_insn_blocks(std::vector<instructions>& insn_blocks);
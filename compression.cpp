@@ -0,0 +1,736 @@
+#include "compression.h"
+
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <iterator>
+#include <vector>
+
+using namespace std::literals::string_literals;
+
+namespace compression
+{
+  // both formats pack bits starting from the least significant bit of each byte
+  class bit_writer
+  {
+  public:
+    void write(uint64_t value, int count)
+    {
+      buffer |= value << used;
+      used += count;
+      while(used >= 8)
+      {
+        output.push_back(char(buffer));
+        buffer >>= 8;
+        used -= 8;
+      }
+    }
+
+    void align(void)
+    {
+      if(used)
+        write(0, 8 - used);
+    }
+
+    std::string output;
+
+  private:
+    uint64_t buffer = 0;
+    int used = 0;
+  };
+
+  // Optimal code lengths of at most limit bits by package-merge.  A lone used symbol gets
+  // length 1 and unused symbols get 0.
+  static std::vector<uint8_t> code_lengths(const std::vector<uint32_t>& frequencies, int limit)
+  {
+    struct node
+    {
+      uint64_t weight;
+      int symbol;         // -1 for packages
+      int left, right;
+    };
+
+    std::vector<uint8_t> lengths(frequencies.size(), 0);
+    std::vector<node> nodes;
+    std::vector<int> leaves;
+    for(std::size_t symbol = 0; symbol < frequencies.size(); ++symbol)
+      if(frequencies[symbol])
+      {
+        leaves.push_back(int(nodes.size()));
+        nodes.push_back({ frequencies[symbol], int(symbol), -1, -1 });
+      }
+
+    if(leaves.size() < 2)
+    {
+      for(int leaf : leaves)
+        lengths[nodes[leaf].symbol] = 1;
+      return lengths;
+    }
+
+    auto lighter = [&nodes](int a, int b) { return nodes[a].weight < nodes[b].weight; };
+    std::stable_sort(std::begin(leaves), std::end(leaves), lighter);
+
+    std::vector<int> list = leaves;
+    for(int level = 1; level < limit; ++level)
+    {
+      std::vector<int> packages;
+      for(std::size_t pos = 0; pos + 1 < list.size(); pos += 2)
+      {
+        packages.push_back(int(nodes.size()));
+        nodes.push_back({ nodes[list[pos]].weight + nodes[list[pos + 1]].weight, -1, list[pos], list[pos + 1] });
+      }
+      list.clear();
+      std::merge(std::begin(leaves), std::end(leaves), std::begin(packages), std::end(packages), std::back_inserter(list), lighter);
+    }
+
+    // every appearance of a leaf in the chosen items adds one to its length
+    std::vector<int> stack(std::begin(list), std::begin(list) + (2 * leaves.size() - 2));
+    while(!stack.empty())
+    {
+      const node& current = nodes[stack.back()];
+      stack.pop_back();
+      if(current.symbol >= 0)
+        ++lengths[current.symbol];
+      else
+      {
+        stack.push_back(current.left);
+        stack.push_back(current.right);
+      }
+    }
+    return lengths;
+  }
+
+  // canonical codes, bit reversed so they can be written least significant bit first
+  struct prefix_code
+  {
+    prefix_code(std::vector<uint8_t> code_lengths)
+      : lengths(std::move(code_lengths)), codes(lengths.size(), 0)
+    {
+      std::array<uint32_t, 17> count = {};
+      for(uint8_t length : lengths)
+        ++count[length];
+      count[0] = 0;
+      std::array<uint32_t, 17> next = {};
+      for(std::size_t length = 1; length < next.size(); ++length)
+        next[length] = (next[length - 1] + count[length - 1]) << 1;
+
+      for(std::size_t symbol = 0; symbol < lengths.size(); ++symbol)
+        if(lengths[symbol])
+        {
+          uint32_t value = next[lengths[symbol]]++;
+          uint16_t reversed = 0;
+          for(int bit = 0; bit < lengths[symbol]; ++bit)
+            reversed |= ((value >> bit) & 1) << (lengths[symbol] - 1 - bit);
+          codes[symbol] = reversed;
+        }
+    }
+
+    void write(bit_writer& out, std::size_t symbol) const
+      { out.write(codes[symbol], lengths[symbol]); }
+
+    std::vector<uint8_t> lengths;
+    std::vector<uint16_t> codes;
+  };
+
+  // ----------------------------------------------------------------------------
+  // LZ77
+
+  struct command
+  {
+    uint32_t insert;     // literals before the copy
+    uint32_t copy;       // zero only for the literals at the end of the input
+    uint32_t distance;
+  };
+
+  struct parse_options
+  {
+    uint32_t window;       // largest distance
+    uint32_t max_length;
+    uint32_t max_chain;    // candidates examined at each position
+    uint32_t nice_length;  // a match this long ends the search
+    bool prefer_last_distance;
+  };
+
+  class match_finder
+  {
+  public:
+    static constexpr uint32_t min_length = 4;
+
+    match_finder(std::string_view input, const parse_options& options)
+      : input(input), options(options), head(1 << hash_bits, -1), previous(input.size(), -1) { }
+
+    uint32_t length_at(uint32_t pos, uint32_t distance) const
+    {
+      uint32_t limit = std::min<std::size_t>(options.max_length, input.size() - pos);
+      uint32_t length = 0;
+      while(length < limit && input[pos + length] == input[pos - distance + length])
+        ++length;
+      return length;
+    }
+
+    // the longest earlier match for pos, a length of 0 if there is none
+    command find(uint32_t pos) const
+    {
+      command best = { 0, 0, 0 };
+      if(pos + min_length > input.size())
+        return best;
+
+      uint32_t lowest = pos > options.window ? pos - options.window : 0;
+      uint32_t chain = options.max_chain;
+      for(int32_t candidate = head[hash(pos)]; candidate >= int32_t(lowest) && chain; candidate = previous[candidate], --chain)
+      {
+        if(pos + best.copy < input.size() && input[candidate + best.copy] != input[pos + best.copy])
+          continue;
+        uint32_t length = length_at(pos, pos - candidate);
+        if(length > best.copy)
+        {
+          best = { 0, length, pos - uint32_t(candidate) };
+          if(length >= options.nice_length)
+            break;
+        }
+      }
+      if(best.copy < min_length)
+        best = { 0, 0, 0 };
+      return best;
+    }
+
+    void insert(uint32_t pos)
+    {
+      if(pos + min_length > input.size())
+        return;
+      uint32_t key = hash(pos);
+      previous[pos] = head[key];
+      head[key] = int32_t(pos);
+    }
+
+  private:
+    static constexpr int hash_bits = 16;
+
+    uint32_t hash(uint32_t pos) const
+    {
+      uint32_t value = uint8_t(input[pos]) | uint8_t(input[pos + 1]) << 8 | uint8_t(input[pos + 2]) << 16 | uint32_t(uint8_t(input[pos + 3])) << 24;
+      return (value * 0x1E35A7BDU) >> (32 - hash_bits);
+    }
+
+    std::string_view input;
+    const parse_options& options;
+    std::vector<int32_t> head;
+    std::vector<int32_t> previous;
+  };
+
+  // greedy parse with one step of lazy evaluation
+  static std::vector<command> parse(std::string_view input, const parse_options& options)
+  {
+    std::vector<command> commands;
+    match_finder finder(input, options);
+    uint32_t last_distance = 0;
+    uint32_t literal_start = 0;
+    for(uint32_t pos = 0; pos < input.size(); )
+    {
+      command best = finder.find(pos);
+      if(options.prefer_last_distance && last_distance && last_distance <= pos)
+      {
+        uint32_t length = finder.length_at(pos, last_distance);
+        if(length >= match_finder::min_length && length + 1 >= best.copy) // reusing a distance is cheaper
+          best = { 0, length, last_distance };
+      }
+      finder.insert(pos);
+
+      if(!best.copy || (pos + 1 < input.size() && finder.find(pos + 1).copy > best.copy))
+      {
+        ++pos;
+        continue;
+      }
+
+      commands.push_back({ pos - literal_start, best.copy, best.distance });
+      last_distance = best.distance;
+      for(uint32_t offset = 1; offset < best.copy; ++offset)
+        finder.insert(pos + offset);
+      pos += best.copy;
+      literal_start = pos;
+    }
+    if(literal_start < input.size() || commands.empty())
+      commands.push_back({ uint32_t(input.size()) - literal_start, 0, 0 });
+    return commands;
+  }
+
+  // index of the last base not above value
+  template<std::size_t N>
+  static std::size_t bucket(const std::array<uint32_t, N>& bases, uint32_t value)
+    { return std::upper_bound(std::begin(bases), std::end(bases), value) - std::begin(bases) - 1; }
+
+  // ----------------------------------------------------------------------------
+  // gzip
+
+  static constexpr std::array<uint32_t, 29> deflate_length_base = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+  static constexpr std::array<uint8_t, 29> deflate_length_extra = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+  static constexpr std::array<uint32_t, 30> deflate_distance_base = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+  static constexpr std::array<uint8_t, 30> deflate_distance_extra = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+  static constexpr std::array<uint8_t, 19> deflate_code_length_order = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+  static constexpr std::array<uint32_t, 256> crc_table = []()
+  {
+    std::array<uint32_t, 256> table = {};
+    for(uint32_t pos = 0; pos < table.size(); ++pos)
+    {
+      uint32_t value = pos;
+      for(int bit = 0; bit < 8; ++bit)
+        value = value & 1 ? 0xEDB88320U ^ (value >> 1) : value >> 1;
+      table[pos] = value;
+    }
+    return table;
+  }();
+
+  static uint32_t crc32(std::string_view input)
+  {
+    uint32_t crc = 0xFFFFFFFFU;
+    for(char c : input)
+      crc = crc_table[(crc ^ uint8_t(c)) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFU;
+  }
+
+  // each side of a block code needs two symbols for the code to be complete
+  static void pad_frequencies(std::vector<uint32_t>& frequencies)
+  {
+    for(std::size_t symbol = 0; std::count_if(std::begin(frequencies), std::end(frequencies), [](uint32_t f) { return f; }) < 2; ++symbol)
+      if(!frequencies[symbol])
+        frequencies[symbol] = 1;
+  }
+
+  // code lengths as the 0-18 run length alphabet of RFC 1951 3.2.7, extra bits alongside
+  static std::vector<std::pair<uint8_t, uint8_t>> deflate_length_runs(const std::vector<uint8_t>& lengths)
+  {
+    std::vector<std::pair<uint8_t, uint8_t>> runs;
+    for(std::size_t pos = 0; pos < lengths.size(); )
+    {
+      uint8_t value = lengths[pos];
+      std::size_t count = 1;
+      while(pos + count < lengths.size() && lengths[pos + count] == value)
+        ++count;
+      pos += count;
+
+      if(!value)
+      {
+        for(; count >= 11; count -= std::min<std::size_t>(count, 138))
+          runs.push_back({ 18, uint8_t(std::min<std::size_t>(count, 138) - 11) });
+        if(count >= 3)
+          runs.push_back({ 17, uint8_t(count - 3) }), count = 0;
+      }
+      else
+      {
+        runs.push_back({ value, 0 });
+        for(--count; count >= 3; count -= std::min<std::size_t>(count, 6))
+          runs.push_back({ 16, uint8_t(std::min<std::size_t>(count, 6) - 3) });
+      }
+      for(; count; --count)
+        runs.push_back({ value, 0 });
+    }
+    return runs;
+  }
+
+  static void write_deflate_block(bit_writer& out, std::string_view input, uint32_t pos,
+                                  std::vector<command>::const_iterator first, std::vector<command>::const_iterator last, bool final)
+  {
+    std::vector<uint32_t> literal_frequencies(286, 0);
+    std::vector<uint32_t> distance_frequencies(30, 0);
+    uint32_t scan = pos;
+    for(auto current = first; current != last; ++current)
+    {
+      for(uint32_t offset = 0; offset < current->insert; ++offset)
+        ++literal_frequencies[uint8_t(input[scan + offset])];
+      if(current->copy)
+      {
+        ++literal_frequencies[257 + bucket(deflate_length_base, current->copy)];
+        ++distance_frequencies[bucket(deflate_distance_base, current->distance)];
+      }
+      scan += current->insert + current->copy;
+    }
+    ++literal_frequencies[256]; // end of block
+    pad_frequencies(literal_frequencies);
+    pad_frequencies(distance_frequencies);
+
+    prefix_code literals(code_lengths(literal_frequencies, 15));
+    prefix_code distances(code_lengths(distance_frequencies, 15));
+
+    std::size_t literal_count = 286;
+    while(literal_count > 257 && !literals.lengths[literal_count - 1])
+      --literal_count;
+    std::size_t distance_count = 30;
+    while(distance_count > 1 && !distances.lengths[distance_count - 1])
+      --distance_count;
+
+    std::vector<uint8_t> all_lengths(std::begin(literals.lengths), std::begin(literals.lengths) + literal_count);
+    all_lengths.insert(std::end(all_lengths), std::begin(distances.lengths), std::begin(distances.lengths) + distance_count);
+    auto runs = deflate_length_runs(all_lengths);
+
+    std::vector<uint32_t> run_frequencies(19, 0);
+    for(const auto& run : runs)
+      ++run_frequencies[run.first];
+    pad_frequencies(run_frequencies);
+    prefix_code run_code(code_lengths(run_frequencies, 7));
+
+    std::size_t order_count = 19;
+    while(order_count > 4 && !run_code.lengths[deflate_code_length_order[order_count - 1]])
+      --order_count;
+
+    out.write(final, 1);
+    out.write(2, 2); // dynamic Huffman codes
+    out.write(literal_count - 257, 5);
+    out.write(distance_count - 1, 5);
+    out.write(order_count - 4, 4);
+    for(std::size_t index = 0; index < order_count; ++index)
+      out.write(run_code.lengths[deflate_code_length_order[index]], 3);
+    for(const auto& run : runs)
+    {
+      run_code.write(out, run.first);
+      if(run.first == 16)
+        out.write(run.second, 2);
+      else if(run.first == 17)
+        out.write(run.second, 3);
+      else if(run.first == 18)
+        out.write(run.second, 7);
+    }
+
+    for(auto current = first; current != last; ++current)
+    {
+      for(uint32_t offset = 0; offset < current->insert; ++offset)
+        literals.write(out, uint8_t(input[pos + offset]));
+      pos += current->insert;
+      if(current->copy)
+      {
+        std::size_t length = bucket(deflate_length_base, current->copy);
+        literals.write(out, 257 + length);
+        out.write(current->copy - deflate_length_base[length], deflate_length_extra[length]);
+        std::size_t distance = bucket(deflate_distance_base, current->distance);
+        distances.write(out, distance);
+        out.write(current->distance - deflate_distance_base[distance], deflate_distance_extra[distance]);
+        pos += current->copy;
+      }
+    }
+    literals.write(out, 256);
+  }
+
+  std::string gzip(std::string_view input)
+  {
+    constexpr parse_options options = { 32768, 258, 128, 258, false };
+    constexpr std::size_t block_commands = 16384;
+
+    bit_writer out;
+    out.output = "\x1F\x8B\x08\x00"s          // deflate, no optional fields
+                 "\x00\x00\x00\x00"s          // no modification time so builds are reproducible
+                 "\x02\x03"s;                 // best compression, Unix
+
+    std::vector<command> commands = parse(input, options);
+    uint32_t pos = 0;
+    for(std::size_t first = 0; first < commands.size(); first += block_commands)
+    {
+      std::size_t last = std::min(commands.size(), first + block_commands);
+      write_deflate_block(out, input, pos, std::begin(commands) + first, std::begin(commands) + last, last == commands.size());
+      for(std::size_t index = first; index < last; ++index)
+        pos += commands[index].insert + commands[index].copy;
+    }
+    out.align();
+
+    uint32_t crc = crc32(input);
+    uint32_t size = uint32_t(input.size());
+    for(int shift = 0; shift < 32; shift += 8)
+      out.output.push_back(char(crc >> shift));
+    for(int shift = 0; shift < 32; shift += 8)
+      out.output.push_back(char(size >> shift));
+    return out.output;
+  }
+
+  // ----------------------------------------------------------------------------
+  // brotli
+
+  static constexpr std::array<uint32_t, 24> brotli_insert_base = { 0, 1, 2, 3, 4, 5, 6, 8, 10, 14, 18, 26, 34, 50, 66, 98, 130, 194, 322, 578, 1090, 2114, 6210, 22594 };
+  static constexpr std::array<uint8_t, 24> brotli_insert_extra = { 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 7, 8, 9, 10, 12, 14, 24 };
+  static constexpr std::array<uint32_t, 24> brotli_copy_base = { 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 14, 18, 22, 30, 38, 54, 70, 102, 134, 198, 326, 582, 1094, 2118 };
+  static constexpr std::array<uint8_t, 24> brotli_copy_extra = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 7, 8, 9, 10, 24 };
+  static constexpr std::array<uint8_t, 18> brotli_code_length_order = { 1, 2, 3, 4, 0, 5, 17, 6, 16, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+  // the fixed code for the lengths of the code length code, RFC 7932 3.5
+  static constexpr std::array<uint8_t, 6> brotli_length_length_code = { 0, 7, 3, 2, 1, 15 };
+  static constexpr std::array<uint8_t, 6> brotli_length_length_bits = { 2, 4, 3, 2, 2, 4 };
+
+  static constexpr uint32_t max_metablock = 1 << 24;
+
+  // insert and copy length symbol, RFC 7932 5
+  static uint16_t brotli_command_symbol(std::size_t insert_code, std::size_t copy_code, bool last_distance)
+  {
+    uint16_t low = uint16_t(((insert_code & 7) << 3) | (copy_code & 7));
+    if(last_distance && insert_code < 8 && copy_code < 16)
+      return copy_code < 8 ? low : low | 64;
+    constexpr uint16_t cells[3][3] = { { 128, 192, 384 }, { 256, 320, 512 }, { 448, 576, 640 } };
+    return cells[insert_code >> 3][copy_code >> 3] | low;
+  }
+
+  // distance symbol and its extra bits without postfix bits or direct codes
+  static std::pair<uint16_t, uint32_t> brotli_distance_symbol(uint32_t distance)
+  {
+    uint32_t value = distance + 3;
+    uint32_t bits = std::bit_width(value) - 2;
+    uint32_t prefix = (value >> bits) & 1;
+    return { uint16_t(16 + 2 * (bits - 1) + prefix), value - ((2 + prefix) << bits) };
+  }
+
+  // code length symbols of RFC 7932 3.5, where consecutive repeat codes multiply
+  static void brotli_repeat(std::vector<std::pair<uint8_t, uint8_t>>& runs, uint8_t code, int extra_bits, std::size_t count)
+  {
+    std::size_t start = runs.size();
+    count -= 3;
+    for(;;)
+    {
+      runs.push_back({ code, uint8_t(count & ((1 << extra_bits) - 1)) });
+      count >>= extra_bits;
+      if(!count)
+        break;
+      --count;
+    }
+    std::reverse(std::begin(runs) + start, std::end(runs));
+  }
+
+  static std::vector<std::pair<uint8_t, uint8_t>> brotli_length_runs(const std::vector<uint8_t>& lengths)
+  {
+    std::size_t used = lengths.size();
+    while(used && !lengths[used - 1])
+      --used;
+
+    std::vector<std::pair<uint8_t, uint8_t>> runs;
+    uint8_t previous = 8; // initial repeated length
+    for(std::size_t pos = 0; pos < used; )
+    {
+      uint8_t value = lengths[pos];
+      std::size_t count = 1;
+      while(pos + count < used && lengths[pos + count] == value)
+        ++count;
+      pos += count;
+
+      if(!value)
+      {
+        if(count == 11)
+          runs.push_back({ 0, 0 }), --count;
+        if(count < 3)
+          runs.insert(std::end(runs), count, { 0, 0 });
+        else
+          brotli_repeat(runs, 17, 3, count);
+      }
+      else
+      {
+        if(previous != value)
+          runs.push_back({ value, 0 }), --count;
+        if(count == 7)
+          runs.push_back({ value, 0 }), --count;
+        if(count < 3)
+          runs.insert(std::end(runs), count, { value, 0 });
+        else
+          brotli_repeat(runs, 16, 2, count);
+        previous = value;
+      }
+    }
+    return runs;
+  }
+
+  // writes the code for frequencies and returns it
+  static prefix_code write_brotli_code(bit_writer& out, const std::vector<uint32_t>& frequencies)
+  {
+    std::vector<uint16_t> used;
+    for(std::size_t symbol = 0; symbol < frequencies.size(); ++symbol)
+      if(frequencies[symbol])
+        used.push_back(uint16_t(symbol));
+
+    if(used.size() < 2) // simple code with one symbol that takes no bits
+    {
+      out.write(1, 2);
+      out.write(0, 2);
+      out.write(used.empty() ? 0 : used[0], std::bit_width(frequencies.size() - 1));
+      return prefix_code(std::vector<uint8_t>(frequencies.size(), 0));
+    }
+
+    prefix_code code(code_lengths(frequencies, 15));
+    auto runs = brotli_length_runs(code.lengths);
+
+    std::vector<uint32_t> run_frequencies(18, 0);
+    for(const auto& run : runs)
+      ++run_frequencies[run.first];
+    std::vector<uint8_t> run_lengths = code_lengths(run_frequencies, 5);
+    bool single_run_symbol = std::count_if(std::begin(run_frequencies), std::end(run_frequencies), [](uint32_t f) { return f; }) == 1;
+
+    // a lone code length symbol takes no bits and the reader then expects all 18 lengths
+    std::size_t order_count = 18;
+    if(!single_run_symbol)
+      while(!run_lengths[brotli_code_length_order[order_count - 1]])
+        --order_count;
+    std::size_t skip = 0;
+    if(!run_lengths[brotli_code_length_order[0]] && !run_lengths[brotli_code_length_order[1]])
+      skip = run_lengths[brotli_code_length_order[2]] ? 2 : 3;
+
+    out.write(skip, 2);
+    for(std::size_t index = skip; index < order_count; ++index)
+    {
+      uint8_t length = run_lengths[brotli_code_length_order[index]];
+      out.write(brotli_length_length_code[length], brotli_length_length_bits[length]);
+    }
+
+    prefix_code run_code(single_run_symbol ? std::vector<uint8_t>(18, 0) : run_lengths);
+    for(const auto& run : runs)
+    {
+      run_code.write(out, run.first);
+      if(run.first == 16)
+        out.write(run.second, 2);
+      else if(run.first == 17)
+        out.write(run.second, 3);
+    }
+    return code;
+  }
+
+  struct brotli_symbols
+  {
+    uint16_t command;
+    uint16_t distance;         // no_distance when the distance is implied
+    uint32_t distance_extra;
+  };
+
+  static constexpr uint16_t no_distance = 0xFFFF;
+
+  static void write_metablock(bit_writer& out, std::string_view input, uint32_t pos,
+                              const command* first, const command* last, const brotli_symbols* symbols, bool final)
+  {
+    uint32_t length = 0;
+    for(const command* current = first; current != last; ++current)
+      length += current->insert + current->copy;
+
+    std::size_t nibbles = std::max(4, int(std::bit_width(length - 1) + 3) / 4);
+    out.write(final, 1);
+    if(final)
+      out.write(0, 1);           // not empty
+    out.write(nibbles - 4, 2);
+    out.write(length - 1, nibbles * 4);
+    if(!final)
+      out.write(0, 1);           // compressed
+    out.write(0, 1);             // one literal block type
+    out.write(0, 1);             // one command block type
+    out.write(0, 1);             // one distance block type
+    out.write(0, 2);             // no distance postfix bits
+    out.write(0, 4);             // no direct distance codes
+    out.write(0, 2);             // literal context mode, unused with one literal code
+    out.write(0, 1);             // one literal code
+    out.write(0, 1);             // one distance code
+
+    std::vector<uint32_t> literal_frequencies(256, 0);
+    std::vector<uint32_t> command_frequencies(704, 0);
+    std::vector<uint32_t> distance_frequencies(64, 0);
+    uint32_t scan = pos;
+    for(const command* current = first; current != last; ++current)
+    {
+      const brotli_symbols& symbol = symbols[current - first];
+      for(uint32_t offset = 0; offset < current->insert; ++offset)
+        ++literal_frequencies[uint8_t(input[scan + offset])];
+      ++command_frequencies[symbol.command];
+      if(symbol.distance != no_distance)
+        ++distance_frequencies[symbol.distance];
+      scan += current->insert + current->copy;
+    }
+
+    prefix_code literals = write_brotli_code(out, literal_frequencies);
+    prefix_code commands = write_brotli_code(out, command_frequencies);
+    prefix_code distances = write_brotli_code(out, distance_frequencies);
+
+    for(const command* current = first; current != last; ++current)
+    {
+      const brotli_symbols& symbol = symbols[current - first];
+      std::size_t insert_code = bucket(brotli_insert_base, current->insert);
+      std::size_t copy_code = bucket(brotli_copy_base, std::max<uint32_t>(current->copy, 2));
+      commands.write(out, symbol.command);
+      out.write(current->insert - brotli_insert_base[insert_code], brotli_insert_extra[insert_code]);
+      out.write(std::max<uint32_t>(current->copy, 2) - brotli_copy_base[copy_code], brotli_copy_extra[copy_code]);
+      for(uint32_t offset = 0; offset < current->insert; ++offset)
+        literals.write(out, uint8_t(input[pos + offset]));
+      pos += current->insert + current->copy;
+      if(symbol.distance != no_distance)
+      {
+        distances.write(out, symbol.distance);
+        if(symbol.distance >= 16)
+          out.write(symbol.distance_extra, (symbol.distance - 16) / 2 + 1);
+      }
+    }
+  }
+
+  std::string brotli(std::string_view input)
+  {
+    int window_bits = 16;
+    while(window_bits < 24 && (std::size_t(1) << window_bits) - 16 < input.size())
+      ++window_bits;
+    const parse_options options = { (1U << window_bits) - 16, 1 << 16, 1024, 1024, true };
+
+    bit_writer out;
+    if(window_bits == 16)
+      out.write(0, 1);
+    else if(window_bits == 17)
+      out.write(1, 7);           // 17 has its own escape after the 3-bit field
+    else
+    {
+      out.write(1, 1);
+      out.write(window_bits - 17, 3);
+    }
+
+    if(input.empty())
+    {
+      out.write(3, 2);           // last and empty
+      out.align();
+      return out.output;
+    }
+
+    std::vector<command> commands = parse(input, options);
+
+    // the distance symbols depend on the four most recent distances, which carry across
+    // meta-blocks, so they are decided in stream order up front
+    std::vector<brotli_symbols> symbols;
+    std::array<uint32_t, 4> recent = { 4, 11, 15, 16 };
+    for(const command& current : commands)
+    {
+      std::size_t insert_code = bucket(brotli_insert_base, current.insert);
+      std::size_t copy_code = bucket(brotli_copy_base, std::max<uint32_t>(current.copy, 2));
+      if(!current.copy) // the meta-block ends after the literals
+      {
+        symbols.push_back({ brotli_command_symbol(insert_code, copy_code, true), no_distance, 0 });
+        continue;
+      }
+
+      if(current.distance == recent[0])
+      {
+        bool implied = insert_code < 8 && copy_code < 16;
+        symbols.push_back({ brotli_command_symbol(insert_code, copy_code, implied), uint16_t(implied ? no_distance : 0), 0 });
+        continue;
+      }
+
+      auto cached = std::find(std::begin(recent) + 1, std::end(recent), current.distance);
+      if(cached != std::end(recent))
+        symbols.push_back({ brotli_command_symbol(insert_code, copy_code, false), uint16_t(cached - std::begin(recent)), 0 });
+      else
+      {
+        auto [distance, extra] = brotli_distance_symbol(current.distance);
+        symbols.push_back({ brotli_command_symbol(insert_code, copy_code, false), distance, extra });
+      }
+      std::copy_backward(std::begin(recent), std::end(recent) - 1, std::end(recent));
+      recent[0] = current.distance;
+    }
+
+    uint32_t pos = 0;
+    for(std::size_t first = 0; first < commands.size(); )
+    {
+      std::size_t last = first;
+      uint32_t length = 0;
+      while(last < commands.size() && length + commands[last].insert + commands[last].copy <= max_metablock)
+        length += commands[last].insert + commands[last].copy, ++last;
+      if(last == first)
+        throw "brotli: literal run longer than a meta-block"s;
+
+      write_metablock(out, input, pos, commands.data() + first, commands.data() + last, symbols.data() + first, last == commands.size());
+      pos += length;
+      first = last;
+    }
+    out.align();
+    return out.output;
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef COMPRESSION_H
+#define COMPRESSION_H
+
+#include <string>
+#include <string_view>
+
+// Bundled encoders for precompressed copies of the page, so static hosting can serve them
+// with Content-Encoding and no compression of its own.  Both read the rendered document in
+// place and return the whole encoded file.
+namespace compression
+{
+  // RFC 1952 gzip with RFC 1951 deflate: lazy matching over the 32KB window and a dynamic
+  // Huffman code for each block
+  std::string gzip(std::string_view input);
+
+  // RFC 7932 brotli: a window covering the whole document, reuse of the last distance and a
+  // longer match search.  Slower than gzip() and a good deal smaller.
+  std::string brotli(std::string_view input);
+}
+
+#endif // COMPRESSION_H
@@ -0,0 +1,51 @@
+#ifndef CYCLE_COST_H
+#define CYCLE_COST_H
+
+#include "build_instructions.h"
+
+#include <cstdint>
+#include <string_view>
+
+// Structured timing of one opcode.  The instruction blocks describe cycles as free-form
+// text such as "2 (4 if branch taken)" or "17 + 6 * $LHLL", this is the same information
+// in a form that can be evaluated without parsing.
+struct cycle_cost
+{
+  uint8_t base;          // cycles when no branch is taken and nothing is transferred
+  uint8_t branch_taken;  // extra cycles when a conditional branch is taken
+  uint8_t per_byte;      // extra cycles for each byte moved by a block transfer
+
+  constexpr uint32_t cycles(bool taken = false, uint32_t transfer_length = 0) const
+    { return base + (taken ? branch_taken : 0) + per_byte * transfer_length; }
+
+  constexpr bool operator==(const cycle_cost&) const = default;
+};
+
+// 7.16MHz clock ticks per CPU cycle after CSH and CSL
+enum clock_speed : uint8_t
+{
+  csh_clock = 1,
+  csl_clock = 4,
+};
+
+constexpr uint64_t clock_ticks(uint64_t cycles, clock_speed speed)
+  { return cycles * speed; }
+
+// length operand of a TII/TDD/TIN/TIA/TAI instruction, where zero means 64KB
+constexpr uint32_t block_length(const uint8_t* instruction)
+{
+  uint32_t length = instruction[5] | (instruction[6] << 8);
+  return length ? length : 0x10000;
+}
+
+constexpr cycle_cost make_cycle_cost(std::string_view mnemonic, uint8_t base, modes_t mode_data)
+{
+  cycle_cost cost = { base, 0, 0 };
+  if(mode_data == Block)
+    cost.per_byte = 6;
+  else if((mode_data & 0xF) == Relative && mnemonic != "BRA" && mnemonic != "BSR") // conditional branches
+    cost.branch_taken = 2;
+  return cost;
+}
+
+#endif // CYCLE_COST_H
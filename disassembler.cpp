@@ -0,0 +1,196 @@
+#include "disassembler.h"
+
+#include <cstring>
+
+using namespace std::literals::string_literals;
+
+static constexpr std::size_t address_column = 0;
+static constexpr std::size_t byte_column = 6;
+static constexpr std::size_t text_column = byte_column + disassembler::max_instruction_size * 3 + 1;
+
+static_assert(disassembler::max_line_size >= 54);
+
+// two hex characters for every byte value
+static constexpr std::array<char, 512> hex_pairs = []
+{
+  constexpr std::string_view digits = "0123456789ABCDEF";
+  std::array<char, 512> pairs = {};
+  for(std::size_t value = 0; value < 256; ++value)
+  {
+    pairs[value * 2] = digits[value >> 4];
+    pairs[value * 2 + 1] = digits[value & 0x0F];
+  }
+  return pairs;
+}();
+
+static inline void write_hex8(char* out, uint8_t value)
+{
+  std::memcpy(out, &hex_pairs[value * 2], 2);
+}
+
+static inline void write_hex16(char* out, uint16_t value)
+{
+  write_hex8(out, value >> 8);
+  write_hex8(out + 2, value & 0xFF);
+}
+
+std::string disassembler::operand_template(modes_t mode_data)
+{
+  uint32_t data = mode_data;
+  while(data && !(data & 0xF0000000))
+    data <<= 4;
+
+  std::string finished;
+  std::string current;
+  bool indexable = false;
+  for(; data & 0xF0000000; data <<= 4)
+  {
+    switch(data >> 28)
+    {
+    case ZeroPage:
+      indexable = true;
+      current.append("$").push_back(byte_operand);
+      break;
+    case Implied:
+      break;
+    case Absolute:
+      indexable = true;
+      current.append("$").push_back(word_operand);
+      break;
+    case Immediate:
+      current.append("#$").push_back(byte_operand);
+      break;
+    case Accumulator:
+      current.append("A");
+      break;
+    case Relative:
+      current.append("$").push_back(relative_operand);
+      break;
+    case Block:
+      current.append("$").append(1, word_operand)
+             .append(", $").append(1, word_operand)
+             .append(", $").append(1, word_operand);
+      break;
+    case Indirect:
+      current = "(" + current + ")";
+      break;
+    case X_Indexed:
+      if(indexable)
+        current.append(", X");
+      break;
+    case Y_Indexed:
+      if(indexable)
+        current.append(", Y");
+      break;
+    case Secondary:
+      finished.append(current).append(", ");
+      current.clear();
+      indexable = false;
+      break;
+    }
+  }
+  return finished + current;
+}
+
+disassembler::line_format disassembler::make_format(std::string_view text, uint8_t byte_count, uint8_t operand_offset)
+{
+  line_format format = {};
+  format.byte_count = byte_count;
+  format.operand_offset = operand_offset;
+  format.text.fill(' ');
+
+  std::size_t pos = text_column;
+  for(char c : text)
+  {
+    if(pos + 4 >= format.text.size())
+      throw "line template too long: "s + std::string(text);
+    switch(c)
+    {
+    case byte_operand:
+    case word_operand:
+    case relative_operand:
+      if(format.operand_count == format.operand_codes.size())
+        throw "too many operands: "s + std::string(text);
+      format.operand_codes[format.operand_count] = operand_code(c);
+      format.operand_positions[format.operand_count] = uint8_t(pos);
+      ++format.operand_count;
+      pos += c == byte_operand ? 2 : 4;
+      break;
+    default:
+      format.text[pos++] = c;
+    }
+  }
+  format.text[pos++] = '\n';
+  format.length = uint8_t(pos);
+  return format;
+}
+
+disassembler::disassembler(isa target)
+  : data_byte(make_format(".db $"s + char(byte_operand), 1, 0))
+{
+  const opcode_table_t& table = opcode_table(target);
+  for(std::size_t opcode = 0; opcode < table.size(); ++opcode)
+  {
+    const opcode_entry& entry = table[opcode];
+    if(!entry.valid()) // unassigned opcodes are listed as data
+    {
+      formats[opcode] = data_byte;
+      continue;
+    }
+
+    std::string text(entry.mnemonic());
+    std::string operands = operand_template(entry.mode_data);
+    if(!operands.empty())
+      text.append(" ").append(operands);
+    formats[opcode] = make_format(text, entry.byte_count, 1);
+  }
+}
+
+std::size_t disassembler::disassemble(const uint8_t* data, std::size_t size, uint16_t address, char*& output, bool final) const
+{
+  char* out = output;
+
+  std::size_t pos = 0;
+  while(pos < size)
+  {
+    const uint8_t* bytes = data + pos;
+    const line_format* format = &formats[*bytes];
+    if(format->byte_count > size - pos)
+    {
+      if(!final)
+        break;
+      format = &data_byte;
+    }
+
+    std::memcpy(out, format->text.data(), format->text.size());
+    write_hex16(out + address_column, address);
+    for(std::size_t i = 0; i < format->byte_count; ++i)
+      write_hex8(out + byte_column + i * 3, bytes[i]);
+
+    const uint8_t* operand = bytes + format->operand_offset;
+    for(std::size_t i = 0; i < format->operand_count; ++i)
+    {
+      char* field = out + format->operand_positions[i];
+      switch(format->operand_codes[i])
+      {
+      case byte_operand:
+        write_hex8(field, *operand++);
+        break;
+      case word_operand:
+        write_hex16(field, operand[0] | (operand[1] << 8));
+        operand += 2;
+        break;
+      case relative_operand:
+        write_hex16(field, address + format->byte_count + int8_t(*operand++));
+        break;
+      }
+    }
+
+    out += format->length;
+    address += format->byte_count;
+    pos += format->byte_count;
+  }
+
+  output = out;
+  return pos;
+}
@@ -0,0 +1,58 @@
+#ifndef DISASSEMBLER_H
+#define DISASSEMBLER_H
+
+#include "opcode_table.h"
+
+#include <cstdint>
+#include <array>
+#include <string>
+#include <string_view>
+
+// Streaming PCEAS syntax disassembler.  Each opcode's line template is prepared once from
+// the opcode table so decoding a byte stream is a table lookup and a few copies per instruction.
+class disassembler
+{
+public:
+  static constexpr std::size_t max_instruction_size = 7;
+  static constexpr std::size_t max_line_size = 64;  // listing characters needed per input byte
+
+  disassembler(isa target = HuC6280);
+
+  // Writes a listing of the complete instructions in [data, data + size) to output, which must
+  // have room for size * max_line_size characters, and advances it past the listing.  address
+  // is the logical address of data[0].  A trailing partial instruction is only listed (as data
+  // bytes) if final is set.  Returns the number of bytes consumed.
+  std::size_t disassemble(const uint8_t* data, std::size_t size, uint16_t address, char*& output, bool final) const;
+
+  // operand template for a mode chain using the byte codes below
+  static std::string operand_template(modes_t mode_data);
+
+  enum operand_code : char
+  {
+    byte_operand = '\x01',
+    word_operand = '\x02',
+    relative_operand = '\x03',
+  };
+
+private:
+  // the whole listing line for an opcode with the hex fields left blank
+  struct line_format
+  {
+    std::array<char, 54> text;
+    uint8_t length;
+    uint8_t byte_count;
+    uint8_t operand_offset;                   // zero when the line lists the opcode byte itself
+    uint8_t operand_count;
+    std::array<uint8_t, 3> operand_positions;
+    std::array<operand_code, 3> operand_codes;
+  };
+
+  static_assert(sizeof(line_format) == 64);
+
+  static line_format make_format(std::string_view text, uint8_t byte_count, uint8_t operand_offset);
+
+  std::array<line_format, 256> formats;
+  line_format data_byte;
+};
+
+#endif // DISASSEMBLER_H
@@ -0,0 +1,88 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+
+#include "disassembler.h"
+
+using namespace std::literals;
+using namespace std::string_view_literals;
+
+// ----------------------------------------------------------------------------
+
+int main (int argc, char** argv)
+{
+  std::ios::sync_with_stdio(false);
+
+  isa target = HuC6280;
+  uint16_t origin = 0;
+  std::vector<std::string_view> files;
+
+  for(int pos = 1; pos < argc; ++pos)
+  {
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--isa="sv))
+      target = parse_isa(arg.substr("--isa="sv.size()));
+    else if(arg.starts_with("--origin="sv))
+      origin = uint16_t(std::strtoul(argv[pos] + "--origin="sv.size(), nullptr, 16));
+    else
+      files.push_back(arg);
+  }
+
+  if(files.empty() || files.size() > 2 || target == None)
+  {
+    std::cerr << "usage: " << argv[0] << " [--isa=HuC6280|WDC65C02|NMOS6502] [--origin=hex] <image> [output]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    std::ifstream fileIn(std::string(files[0]), std::ios::binary);
+    if(!fileIn)
+      throw "unable to open: "s + std::string(files[0]);
+
+    std::ofstream fileOut;
+    std::ostream* out = &std::cout;
+    if(files.size() == 2)
+    {
+      fileOut.open(std::string(files[1]), std::ios::binary);
+      if(!fileOut)
+        throw "unable to open: "s + std::string(files[1]);
+      out = &fileOut;
+    }
+
+    const disassembler dis(target);
+    constexpr std::size_t chunk_size = 64 * 1024;
+    std::vector<uint8_t> buffer(chunk_size + disassembler::max_instruction_size);
+    std::vector<char> listing(buffer.size() * disassembler::max_line_size);
+    std::size_t held = 0; // bytes of an incomplete instruction carried over from the last chunk
+    uint16_t address = origin;
+
+    for(;;)
+    {
+      fileIn.read(reinterpret_cast<char*>(buffer.data() + held), chunk_size);
+      std::size_t size = held + fileIn.gcount();
+      bool final = !fileIn;
+
+      char* end = listing.data();
+      std::size_t used = dis.disassemble(buffer.data(), size, address, end, final);
+      out->write(listing.data(), end - listing.data());
+
+      address += uint16_t(used);
+      held = size - used;
+      std::memmove(buffer.data(), buffer.data() + used, held);
+      if(final)
+        break;
+    }
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return 0;
+}
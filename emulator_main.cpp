@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+
+#include "execution_trace.h"
+#include "huc6280_core.h"
+
+using namespace std::literals;
+using namespace std::string_view_literals;
+
+// ----------------------------------------------------------------------------
+
+// run() with a trace record written for each instruction
+static uint64_t run_traced(huc6280_core& cpu, uint64_t ticks, trace_writer& trace)
+{
+  const opcode_table_t& table = opcode_table(HuC6280);
+  uint64_t start = cpu.clock;
+  while(cpu.clock - start < ticks)
+  {
+    trace::record entry = { cpu.regs.pc, cpu.regs.mpr[cpu.regs.pc >> 13], 0, {}, 0 };
+    const opcode_entry& op = table[cpu.read(cpu.regs.pc)];
+    for(uint8_t pos = 0; pos < std::max<uint8_t>(op.byte_count, 1); ++pos)
+      entry.bytes[pos] = cpu.read(uint16_t(cpu.regs.pc + pos));
+
+    uint64_t cycles = cpu.cycles;
+    cpu.step();
+    cycles = cpu.cycles - cycles;
+    if(op.cost.branch_taken && cycles > op.cost.base)
+      entry.flags |= trace::branch_taken;
+    if(op.valid())
+    {
+      uint32_t expected = instruction_cycles(op, entry.bytes.data(), entry.flags & trace::branch_taken);
+      entry.extra_cycles = uint8_t(std::min<uint64_t>(cycles > expected ? cycles - expected : 0, 0xFF));
+    }
+    trace.append(entry);
+  }
+  return cpu.clock - start;
+}
+
+int main (int argc, char** argv)
+{
+  double seconds = 1.0;
+  std::string trace_filename;
+  std::vector<std::string_view> files;
+
+  for(int pos = 1; pos < argc; ++pos)
+  {
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--seconds="sv))
+      seconds = std::strtod(argv[pos] + "--seconds="sv.size(), nullptr);
+    else if(arg.starts_with("--trace="sv))
+      trace_filename = arg.substr("--trace="sv.size());
+    else
+      files.push_back(arg);
+  }
+
+  if(files.size() != 1 || seconds <= 0)
+  {
+    std::cerr << "usage: " << argv[0] << " [--seconds=n] [--trace=file] <rom image>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    std::ifstream fileIn(std::string(files[0]), std::ios::binary);
+    if(!fileIn)
+      throw "unable to open: "s + std::string(files[0]);
+
+    huc6280_core cpu;
+    std::vector<uint8_t> image((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+    std::size_t offset = image.size() % huc6280_core::bank_size == 512 ? 512 : 0; // copier header
+    if(image.size() - offset > huc6280_core::physical_size)
+      throw "image too large: "s + std::string(files[0]);
+    std::copy(std::begin(image) + offset, std::end(image), std::begin(cpu.memory()));
+
+    cpu.reset();
+
+    constexpr double clock_rate = 7159090.0;
+    auto start = std::chrono::steady_clock::now();
+    uint64_t ticks;
+    if(trace_filename.empty())
+      ticks = cpu.run(uint64_t(seconds * clock_rate));
+    else
+    {
+      trace_writer trace(trace_filename, HuC6280);
+      ticks = run_traced(cpu, uint64_t(seconds * clock_rate), trace);
+      trace.close();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::hex << std::uppercase << std::setfill('0')
+              << "PC=" << std::setw(4) << cpu.regs.pc
+              << " A=" << std::setw(2) << int(cpu.regs.a)
+              << " X=" << std::setw(2) << int(cpu.regs.x)
+              << " Y=" << std::setw(2) << int(cpu.regs.y)
+              << " S=" << std::setw(2) << int(cpu.regs.s)
+              << " P=" << std::setw(2) << int(cpu.regs.p)
+              << " MPR=";
+    for(uint8_t bank : cpu.regs.mpr)
+      std::cout << std::setw(2) << int(bank);
+    std::cout << std::dec << std::endl
+              << cpu.cycles << " cycles, "
+              << ticks / clock_rate / elapsed.count() << "x real time" << std::endl;
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return 0;
+}
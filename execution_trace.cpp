@@ -0,0 +1,28 @@
+#include "execution_trace.h"
+
+using namespace std::literals::string_literals;
+
+trace_writer::trace_writer(const std::string& filename, isa target)
+  : filename(filename),
+    fileOut(filename, std::ios::binary)
+{
+  trace::header head = { trace::magic, trace::version, uint16_t(sizeof(trace::record)), uint16_t(target), 0 };
+  if(!fileOut.write(reinterpret_cast<const char*>(&head), sizeof(head)))
+    throw "unable to write: "s + filename;
+  buffer.reserve(buffer_records);
+}
+
+void trace_writer::flush(void)
+{
+  if(!fileOut.write(reinterpret_cast<const char*>(buffer.data()), std::streamsize(buffer.size() * sizeof(trace::record))))
+    throw "unable to write: "s + filename;
+  buffer.clear();
+}
+
+void trace_writer::close(void)
+{
+  flush();
+  fileOut.close();
+  if(!fileOut)
+    throw "unable to write: "s + filename;
+}
@@ -0,0 +1,82 @@
+#ifndef EXECUTION_TRACE_H
+#define EXECUTION_TRACE_H
+
+#include "build_instructions.h"
+
+#include <cstdint>
+#include <array>
+#include <bit>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Binary execution trace written by the emulator, one fixed-size little endian record per
+// executed instruction after a header:
+//
+//   trace::header
+//   trace::record[]                        until the end of the file
+//
+// A record holds the whole instruction, so cycles can be recomputed from the opcode table
+// without the memory it ran from.  The cycles the table cannot know, the T flag and decimal
+// mode ADC/SBC, are recorded beside it.  Records are written in host byte order, which must be
+// little endian.
+namespace trace
+{
+  constexpr std::array<char, 8> magic = { 'H', 'u', 'C', '6', '2', '8', '0', 'T' };
+  constexpr uint16_t version = 2;
+
+  enum record_flag : uint8_t
+  {
+    branch_taken = 0x01,          // a conditional branch that went to its target
+  };
+
+  struct header
+  {
+    std::array<char, 8> magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint16_t cpus;                // isa whose opcode table decodes the records
+    uint16_t reserved;
+  };
+
+  struct record
+  {
+    uint16_t pc;
+    uint8_t bank;                 // MPR of the 8KB page holding pc
+    uint8_t flags;
+    std::array<uint8_t, 7> bytes; // opcode and operands, zero past the instruction
+    uint8_t extra_cycles;         // spent beyond instruction_cycles(): T flag and decimal mode
+  };
+
+  static_assert(sizeof(header) == 16);
+  static_assert(sizeof(record) == 12);
+  static_assert(std::endian::native == std::endian::little, "records are written in host byte order");
+}
+
+// Buffers records and writes them in large blocks.  close() writes whatever is left and
+// throws if anything could not be written.
+class trace_writer
+{
+public:
+  trace_writer(const std::string& filename, isa target);
+
+  void append(const trace::record& entry)
+  {
+    buffer.push_back(entry);
+    if(buffer.size() == buffer_records)
+      flush();
+  }
+
+  void close(void);
+
+private:
+  static constexpr std::size_t buffer_records = 0x10000;
+
+  void flush(void);
+
+  std::string filename;
+  std::ofstream fileOut;
+  std::vector<trace::record> buffer;
+};
+
+#endif // EXECUTION_TRACE_H
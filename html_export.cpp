@@ -0,0 +1,188 @@
+#include "html_export.h"
+
+#include "post_processing.h"
+
+#include <array>
+#include <cctype>
+#include <regex>
+
+std::string fix_id(std::string data)
+{
+  static const std::regex var_pattern("<var[^>]+>([^<]+)</var>", std::regex_constants::extended);
+  static const std::regex space_pattern("[[:space:]]", std::regex_constants::extended);
+
+  data = std::regex_replace(data, var_pattern,
+                            "\\1", std::regex_constants::format_sed);
+
+  data = std::regex_replace(data, space_pattern,
+                            "", std::regex_constants::format_sed);
+  data = "code" + data;
+  return data;
+}
+
+std::string build_span_section (std::string_view word_title, std::string tag_title, std::string_view val)
+{
+  std::string rval;
+  if(!val.empty())
+  {
+    rval.append("<span title=\"section\">")
+        .append(word_title)
+        .append("</span>\n")
+        .append("<span title=\"")
+        .append(tag_title)
+        .append("\">")
+        .append(val)
+        .append("</span>\n");
+  }
+  return rval;
+}
+
+
+std::string build_isa_list (const mode_details& md)
+{
+  static isa_property names = isa_property
+  {
+    NMOS6502, "NMOS6502",
+    WDC65C02, "WDC65C02",
+    HuC6280, "HuC6280",
+  };
+  constexpr static const std::array<isa, isa_count> list = { NMOS6502,
+                                                             WDC65C02,
+                                                             HuC6280 };
+  auto func = [](bool match, const std::string_view& prop) -> std::string
+  {
+    if(match)
+      return std::string(" ").append(prop);
+    return std::string();
+  };
+  std::string r;
+  for(std::size_t pos = 0; pos < list.size(); ++pos)
+    r += func(md.cpus & list[pos], names[list[pos]]);
+  return r;
+}
+
+std::string build_isa_tagged_property_list (const mode_details& md, const isa_property& p)
+{
+  constexpr static const std::array<isa, isa_count> list = { NMOS6502,
+                                                             WDC65C02,
+                                                             HuC6280 };
+  auto func = [](bool match, const std::string_view& prop) -> std::string
+  {
+    if(match && !prop.empty())
+      return std::string("<var>").append(prop).append("</var>");
+    return "<var></var>";
+  };
+  std::string r;
+  for(std::size_t pos = 0; pos < list.size(); ++pos)
+    r += func(md.cpus & list[pos], p[list[pos]]);
+  return r;
+}
+
+
+std::string fragment_filename(std::string_view section_title)
+{
+  std::string name = "fragments/";
+  bool separator = false;
+  for(char c : section_title)
+  {
+    if(std::isalnum(uint8_t(c)))
+    {
+      if(separator)
+        name.push_back('_');
+      name.push_back(char(std::tolower(uint8_t(c))));
+      separator = false;
+    }
+    else
+      separator = true;
+  }
+  return name.append(".html");
+}
+
+// fetches the fragment of a section the first time one of its rows is opened
+static constexpr const char* fragment_loader = R"html(<script>
+const fragments = {};
+document.addEventListener("change", event => {
+  const details = event.target.nextElementSibling?.querySelector(".details[data-fragment]");
+  if(!details)
+    return;
+  const url = details.dataset.fragment;
+  fragments[url] ??= fetch(url)
+    .then(response => response.ok ? response.text() : Promise.reject(response.status))
+    .then(text => {
+      for(const source of new DOMParser().parseFromString(text, "text/html").querySelectorAll("[data-row]"))
+      {
+        const target = document.querySelector(`label[for="row${source.dataset.row}"] > .details`);
+        target.innerHTML = source.innerHTML;
+        target.removeAttribute("data-fragment");
+      }
+    })
+    .catch(() => delete fragments[url]);
+});
+</script>
+)html";
+
+void build_page_rows(std::string& document, const std::vector<instructions>& insn_blocks, std::vector<std::string>* fragments)
+{
+  int id = 0;
+  for (const auto& block : insn_blocks)
+  {
+    document.append("<span class=\"section_title\">").append(block.section_title).append("</span>\n");
+
+    std::string* fragment = nullptr;
+    std::string filename;
+    if(fragments)
+    {
+      fragment = &fragments->emplace_back();
+      filename = fragment_filename(block.section_title);
+    }
+
+    for (const auto& i : block)
+    {
+      for (const auto& md : i.data<std::vector<mode_details>>())
+      {
+        std::string row_id = std::to_string(id);
+        document.append("<input name=\"instruction\" type=\"radio\" id=\"row").append(row_id).append("\" />\n")
+                .append("<label class=\"summary").append(build_isa_list(md)).append("\" for=\"row").append(row_id).append("\">\n")
+                .append("<span class=\"cpu_grid\"><var></var><var></var><var></var></span>\n")
+                .append("<span>").append(md.pceas_syntax_string).append("</span>\n")
+                .append("<span>").append(md.abstract_string).append("</span>\n")
+                .append("<span id=\"").append(fix_id(md.machine)).append("\" class=\"colorized\">").append(md.machine).append("</span>\n")
+                .append("<span>").append(build_flags(i.data<flags>())).append("</span>\n")
+                .append("<span>").append(md.address_mode_string).append("</span>\n");
+//                .append("<span class=\"cycle_grid\">").append(build_isa_tagged_property_list (i, i.data<group>())).append("</span>\n")
+//                .append("<span class=\"cycle_grid\">").append(build_isa_tagged_property_list (i, i.data<issue>())).append("</span>\n")
+//                .append("<span class=\"cycle_grid\">").append(build_isa_tagged_property_list (i, i.data<latency>())).append("</span>\n")
+
+        std::string* details = &document;
+        if(fragment)
+        {
+          document.append("<span class=\"details\" data-fragment=\"").append(filename).append("\"></span>\n");
+          fragment->append("<div data-row=\"").append(row_id).append("\">\n");
+          details = fragment;
+        }
+        else
+          document.append("<span class=\"details\">\n");
+
+//        details->append(build_environments (i.data<environments>()));
+//        details->append(build_citations (i.data<citations>()));
+        details->append(build_span_section (md.name_string, "summary", md.description_string));
+        details->append(build_span_section ("Note", "note", i.data<note>()));
+//        details->append(build_span_section ("Operation", "operation", i.data<operation>()));
+//        details->append(build_span_section ("Example", "assembly", i.data<example>()));
+//        details->append(build_span_section ("Possible Exceptions", "list", i.data<exceptions>()));
+
+        if(fragment)
+          fragment->append("</div>\n");
+        else
+          document.append("</span>\n"); // close "details"
+        document.append("</label>\n");
+        ++id;
+      }
+    }
+  }
+
+  if(fragments)
+    document.append(fragment_loader);
+  document.append("</body>\n")
+          .append("</html>\n");
+}
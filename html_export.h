@@ -0,0 +1,30 @@
+#ifndef HTML_EXPORT_H
+#define HTML_EXPORT_H
+
+#include "build_instructions.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// element id of a machine code column, e.g. "code6Dllhh"
+std::string fix_id(std::string data);
+
+std::string build_span_section(std::string_view word_title, std::string tag_title, std::string_view val);
+
+// class list of the isas a mode row belongs to, e.g. " WDC65C02 HuC6280"
+std::string build_isa_list(const mode_details& md);
+
+std::string build_isa_tagged_property_list(const mode_details& md, const isa_property& p);
+
+// path of the details fragment of a section relative to the page,
+// e.g. "fragments/branching_operations.html"
+std::string fragment_filename(std::string_view section_title);
+
+// Appends a label for each mode row of the post-processed instruction blocks and closes
+// the page opened by the page header.  With fragments the details of each row are left
+// out of the page and appended to one fragment per block instead, which a script at the
+// end of the page fetches when a row of that block is first opened.
+void build_page_rows(std::string& document, const std::vector<instructions>& insn_blocks, std::vector<std::string>* fragments = nullptr);
+
+#endif // HTML_EXPORT_H
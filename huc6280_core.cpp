@@ -0,0 +1,411 @@
+#include "huc6280_core.h"
+
+#include <bit>
+#include <string_view>
+#include <utility>
+
+using namespace std::literals::string_view_literals;
+
+// addressing mode chain that follows the Secondary marker, e.g. ZeroPage | X_Indexed for TST
+static constexpr modes_t secondary_mode(modes_t mode)
+{
+  for(int shift = 0; shift < 32; shift += 4)
+    if(((uint32_t(mode) >> shift) & 0xF) == Secondary)
+      return modes_t(uint32_t(mode) & ((1u << shift) - 1));
+  return modes_t(0);
+}
+
+// bit number of the "#" families, e.g. BBR3
+static constexpr int family_bit(std::string_view name)
+{
+  return name.size() == 4 ? name[3] - '0' : 0;
+}
+
+huc6280_core::huc6280_core(void)
+  : physical(physical_size, 0)
+{
+  for(std::size_t bank = 0; bank < banks.size(); ++bank)
+    set_mpr(bank, 0);
+}
+
+void huc6280_core::set_mpr(std::size_t bank, uint8_t value)
+{
+  regs.mpr[bank] = value;
+  banks[bank] = physical.data() + value * bank_size;
+}
+
+void huc6280_core::reset(void)
+{
+  set_mpr(7, 0);
+  regs.p = I_flag;
+  regs.pc = read_word(reset_vector);
+  set_high_speed(false);
+}
+
+uint8_t huc6280_core::adc(uint8_t lhs, uint8_t rhs)
+{
+  unsigned carry = regs.p & C_flag;
+  unsigned binary = lhs + rhs + carry;
+  unsigned result = binary;
+
+  regs.p &= ~(V_flag | C_flag);
+  if(~(lhs ^ rhs) & (lhs ^ binary) & 0x80)
+    regs.p |= V_flag;
+
+  if(regs.p & D_flag)
+  {
+    unsigned low = (lhs & 0x0F) + (rhs & 0x0F) + carry;
+    if(low > 0x09)
+      low += 0x06;
+    result = (lhs & 0xF0) + (rhs & 0xF0) + low;
+    if(result > 0x9F)
+      result += 0x60;
+    add_cycles(1);
+  }
+
+  if(result > 0xFF)
+    regs.p |= C_flag;
+  set_nz(uint8_t(result));
+  return uint8_t(result);
+}
+
+uint8_t huc6280_core::sbc(uint8_t lhs, uint8_t rhs)
+{
+  if(!(regs.p & D_flag))
+    return adc(lhs, ~rhs);
+
+  int borrow = (regs.p & C_flag) ? 0 : 1;
+  int binary = lhs - rhs - borrow;
+  int result = binary;
+  if((lhs & 0x0F) - (rhs & 0x0F) - borrow < 0)
+    result -= 0x06;
+  if(binary < 0)
+    result -= 0x60;
+
+  regs.p &= ~(V_flag | C_flag);
+  if((lhs ^ rhs) & (lhs ^ binary) & 0x80)
+    regs.p |= V_flag;
+  if(binary >= 0)
+    regs.p |= C_flag;
+  set_nz(uint8_t(result));
+  add_cycles(1);
+  return uint8_t(result);
+}
+
+void huc6280_core::compare(uint8_t lhs, uint8_t rhs)
+{
+  regs.p = (regs.p & ~C_flag) | (lhs >= rhs ? C_flag : 0);
+  set_nz(uint8_t(lhs - rhs));
+}
+
+template<uint8_t opcode>
+inline void huc6280_core::execute(void)
+{
+  constexpr const opcode_entry& entry = huc6280_opcodes[opcode];
+  constexpr std::string_view name = entry.mnemonic();
+  constexpr modes_t mode = entry.mode_data;
+  constexpr bool has_secondary = secondary_mode(mode) != modes_t(0);
+  constexpr modes_t target_mode = has_secondary ? secondary_mode(mode) : mode;
+  constexpr uint16_t size = entry.valid() ? entry.byte_count : 1;
+  constexpr int bit = family_bit(name);
+
+  const uint16_t pc = regs.pc;
+  const bool memory_mode = regs.p & T_flag; // SET only affects the next instruction
+  regs.p &= ~T_flag;
+  regs.pc = pc + size;
+  add_cycles(entry.valid() ? entry.cost.base : 2); // undefined opcodes are NOPs
+
+  // operand bytes follow the immediate value for TST
+  constexpr uint16_t address_offset = has_secondary && name == "TST"sv ? 2 : 1;
+
+  auto address = [this, pc](void) -> uint16_t
+  {
+    const uint16_t operand = pc + address_offset;
+    if constexpr (target_mode == ZeroPage)
+      return zero_page | read(operand);
+    if constexpr (target_mode == (ZeroPage | X_Indexed))
+      return zero_page | uint8_t(read(operand) + regs.x);
+    if constexpr (target_mode == (ZeroPage | Y_Indexed))
+      return zero_page | uint8_t(read(operand) + regs.y);
+    if constexpr (target_mode == (ZeroPage | Indirect))
+      return read_zp_word(read(operand));
+    if constexpr (target_mode == (ZeroPage | X_Indexed | Indirect))
+      return read_zp_word(read(operand) + regs.x);
+    if constexpr (target_mode == (ZeroPage | Indirect | Y_Indexed))
+      return read_zp_word(read(operand)) + regs.y;
+    if constexpr (target_mode == Absolute)
+      return read_word(operand);
+    if constexpr (target_mode == (Absolute | X_Indexed))
+      return read_word(operand) + regs.x;
+    if constexpr (target_mode == (Absolute | Y_Indexed))
+      return read_word(operand) + regs.y;
+    if constexpr (target_mode == (Absolute | Indirect))
+      return read_word(read_word(operand));
+    if constexpr (target_mode == (Absolute | X_Indexed | Indirect))
+      return read_word(uint16_t(read_word(operand) + regs.x));
+    return 0;
+  };
+
+  auto load = [this, pc, &address](void) -> uint8_t
+  {
+    if constexpr (mode == Immediate)
+      return read(pc + 1);
+    else
+      return read(address());
+  };
+
+  auto branch = [this, pc](bool taken)
+  {
+    if(taken)
+    {
+      regs.pc = pc + size + int8_t(read(pc + size - 1));
+      add_cycles(entry.cost.branch_taken);
+    }
+  };
+
+  // read-modify-write on the accumulator or memory
+  auto modify = [this, &address](auto&& operation)
+  {
+    if constexpr (mode == Accumulator)
+      regs.a = operation(regs.a);
+    else
+    {
+      uint16_t target = address();
+      write(target, operation(read(target)));
+    }
+  };
+
+  // T flag: ADC/AND/EOR/ORA use the zero page byte at X in place of the accumulator
+  auto accumulate = [this, memory_mode](auto&& operation)
+  {
+    if(memory_mode)
+    {
+      uint16_t target = zero_page | regs.x;
+      write(target, operation(read(target)));
+      add_cycles(3);
+    }
+    else
+      regs.a = operation(regs.a);
+  };
+
+  if constexpr (!entry.valid() || name == "NOP"sv)
+    return;
+
+  // loads and stores
+  else if constexpr (name == "LDA"sv) set_nz(regs.a = load());
+  else if constexpr (name == "LDX"sv) set_nz(regs.x = load());
+  else if constexpr (name == "LDY"sv) set_nz(regs.y = load());
+  else if constexpr (name == "STA"sv) write(address(), regs.a);
+  else if constexpr (name == "STX"sv) write(address(), regs.x);
+  else if constexpr (name == "STY"sv) write(address(), regs.y);
+  else if constexpr (name == "STZ"sv) write(address(), 0);
+  else if constexpr (name == "ST0"sv) physical[0x1FE000] = read(pc + 1);
+  else if constexpr (name == "ST1"sv) physical[0x1FE002] = read(pc + 1);
+  else if constexpr (name == "ST2"sv) physical[0x1FE003] = read(pc + 1);
+
+  // arithmetic and logic
+  else if constexpr (name == "ADC"sv) { uint8_t value = load(); accumulate([&](uint8_t lhs) { return adc(lhs, value); }); }
+  else if constexpr (name == "SBC"sv) regs.a = sbc(regs.a, load());
+  else if constexpr (name == "AND"sv) { uint8_t value = load(); accumulate([&](uint8_t lhs) { set_nz(lhs &= value); return lhs; }); }
+  else if constexpr (name == "ORA"sv) { uint8_t value = load(); accumulate([&](uint8_t lhs) { set_nz(lhs |= value); return lhs; }); }
+  else if constexpr (name == "EOR"sv) { uint8_t value = load(); accumulate([&](uint8_t lhs) { set_nz(lhs ^= value); return lhs; }); }
+  else if constexpr (name == "CMP"sv) compare(regs.a, load());
+  else if constexpr (name == "CPX"sv) compare(regs.x, load());
+  else if constexpr (name == "CPY"sv) compare(regs.y, load());
+  else if constexpr (name == "BIT"sv || name == "TST"sv)
+  {
+    uint8_t value = name == "TST"sv ? read(address()) : load();
+    uint8_t mask = name == "TST"sv ? read(pc + 1) : regs.a;
+    regs.p = (regs.p & ~(N_flag | V_flag | Z_flag)) | (value & (N_flag | V_flag)) | ((mask & value) ? 0 : Z_flag);
+  }
+  else if constexpr (name == "TSB"sv)
+  {
+    modify([this](uint8_t value) -> uint8_t
+    {
+      uint8_t result = value | regs.a;
+      regs.p = (regs.p & ~(N_flag | V_flag | Z_flag)) | (result & (N_flag | V_flag)) | (result ? 0 : Z_flag);
+      return result;
+    });
+  }
+  else if constexpr (name == "TRB"sv)
+  {
+    modify([this](uint8_t value) -> uint8_t
+    {
+      regs.p = (regs.p & ~(N_flag | V_flag | Z_flag)) | (value & (N_flag | V_flag)) | ((value & regs.a) ? 0 : Z_flag);
+      return value & ~regs.a;
+    });
+  }
+
+  // shifts, rotates, increments and decrements
+  else if constexpr (name == "ASL"sv) modify([this](uint8_t v) -> uint8_t { regs.p = (regs.p & ~C_flag) | (v >> 7); set_nz(v <<= 1); return v; });
+  else if constexpr (name == "LSR"sv) modify([this](uint8_t v) -> uint8_t { regs.p = (regs.p & ~C_flag) | (v & 1); set_nz(v >>= 1); return v; });
+  else if constexpr (name == "ROL"sv) modify([this](uint8_t v) -> uint8_t { uint8_t r = (v << 1) | (regs.p & C_flag); regs.p = (regs.p & ~C_flag) | (v >> 7); set_nz(r); return r; });
+  else if constexpr (name == "ROR"sv) modify([this](uint8_t v) -> uint8_t { uint8_t r = (v >> 1) | ((regs.p & C_flag) << 7); regs.p = (regs.p & ~C_flag) | (v & 1); set_nz(r); return r; });
+  else if constexpr (name == "INC"sv) modify([this](uint8_t v) -> uint8_t { set_nz(++v); return v; });
+  else if constexpr (name == "DEC"sv) modify([this](uint8_t v) -> uint8_t { set_nz(--v); return v; });
+  else if constexpr (name == "INX"sv) set_nz(++regs.x);
+  else if constexpr (name == "INY"sv) set_nz(++regs.y);
+  else if constexpr (name == "DEX"sv) set_nz(--regs.x);
+  else if constexpr (name == "DEY"sv) set_nz(--regs.y);
+
+  // register transfers and exchanges
+  else if constexpr (name == "TAX"sv) set_nz(regs.x = regs.a);
+  else if constexpr (name == "TAY"sv) set_nz(regs.y = regs.a);
+  else if constexpr (name == "TXA"sv) set_nz(regs.a = regs.x);
+  else if constexpr (name == "TYA"sv) set_nz(regs.a = regs.y);
+  else if constexpr (name == "TSX"sv) set_nz(regs.x = regs.s);
+  else if constexpr (name == "TXS"sv) regs.s = regs.x;
+  else if constexpr (name == "SXY"sv) std::swap(regs.x, regs.y);
+  else if constexpr (name == "SAX"sv) std::swap(regs.a, regs.x);
+  else if constexpr (name == "SAY"sv) std::swap(regs.a, regs.y);
+  else if constexpr (name == "CLA"sv) regs.a = 0;
+  else if constexpr (name == "CLX"sv) regs.x = 0;
+  else if constexpr (name == "CLY"sv) regs.y = 0;
+
+  // status flags
+  else if constexpr (name == "CLC"sv) regs.p &= ~C_flag;
+  else if constexpr (name == "SEC"sv) regs.p |= C_flag;
+  else if constexpr (name == "CLD"sv) regs.p &= ~D_flag;
+  else if constexpr (name == "SED"sv) regs.p |= D_flag;
+  else if constexpr (name == "CLI"sv) regs.p &= ~I_flag;
+  else if constexpr (name == "SEI"sv) regs.p |= I_flag;
+  else if constexpr (name == "CLV"sv) regs.p &= ~V_flag;
+  else if constexpr (name == "SET"sv) regs.p |= T_flag;
+
+  // stack
+  else if constexpr (name == "PHA"sv) push(regs.a);
+  else if constexpr (name == "PHX"sv) push(regs.x);
+  else if constexpr (name == "PHY"sv) push(regs.y);
+  else if constexpr (name == "PHP"sv) push(regs.p | B_flag);
+  else if constexpr (name == "PLA"sv) set_nz(regs.a = pull());
+  else if constexpr (name == "PLX"sv) set_nz(regs.x = pull());
+  else if constexpr (name == "PLY"sv) set_nz(regs.y = pull());
+  else if constexpr (name == "PLP"sv) regs.p = pull();
+
+  // branches
+  else if constexpr (name == "BRA"sv) branch(true);
+  else if constexpr (name == "BCC"sv) branch(!(regs.p & C_flag));
+  else if constexpr (name == "BCS"sv) branch(regs.p & C_flag);
+  else if constexpr (name == "BNE"sv) branch(!(regs.p & Z_flag));
+  else if constexpr (name == "BEQ"sv) branch(regs.p & Z_flag);
+  else if constexpr (name == "BPL"sv) branch(!(regs.p & N_flag));
+  else if constexpr (name == "BMI"sv) branch(regs.p & N_flag);
+  else if constexpr (name == "BVC"sv) branch(!(regs.p & V_flag));
+  else if constexpr (name == "BVS"sv) branch(regs.p & V_flag);
+  else if constexpr (name.starts_with("BBR"sv)) branch(!(read(zero_page | read(pc + 1)) & (1 << bit)));
+  else if constexpr (name.starts_with("BBS"sv)) branch(read(zero_page | read(pc + 1)) & (1 << bit));
+  else if constexpr (name.starts_with("RMB"sv)) modify([](uint8_t v) -> uint8_t { return v & ~(1 << bit); });
+  else if constexpr (name.starts_with("SMB"sv)) modify([](uint8_t v) -> uint8_t { return v | (1 << bit); });
+
+  // subroutines and interrupts
+  else if constexpr (name == "JMP"sv) regs.pc = address();
+  else if constexpr (name == "JSR"sv || name == "BSR"sv)
+  {
+    uint16_t return_address = pc + size - 1; // last byte of the instruction
+    push(return_address >> 8);
+    push(return_address & 0xFF);
+    if constexpr (name == "JSR"sv)
+      regs.pc = address();
+    else
+      regs.pc = pc + size + int8_t(read(pc + 1));
+  }
+  else if constexpr (name == "RTS"sv)
+  {
+    uint16_t low = pull();
+    regs.pc = (low | (pull() << 8)) + 1;
+  }
+  else if constexpr (name == "BRK"sv)
+  {
+    uint16_t return_address = pc + 2;
+    push(return_address >> 8);
+    push(return_address & 0xFF);
+    push(regs.p | B_flag);
+    regs.p = (regs.p | I_flag) & ~D_flag;
+    regs.pc = read_word(irq2_vector);
+  }
+  else if constexpr (name == "RTI"sv)
+  {
+    regs.p = pull();
+    uint16_t low = pull();
+    regs.pc = low | (pull() << 8);
+  }
+
+  // memory mapping and clock speed
+  else if constexpr (name == "TAM"sv)
+  {
+    uint8_t banks_selected = read(pc + 1);
+    for(std::size_t bank = 0; bank < banks.size(); ++bank)
+      if(banks_selected & (1 << bank))
+        set_mpr(bank, regs.a);
+  }
+  else if constexpr (name == "TMA"sv)
+  {
+    uint8_t banks_selected = read(pc + 1);
+    if(banks_selected)
+      regs.a = regs.mpr[std::countr_zero(banks_selected)];
+  }
+  else if constexpr (name == "CSH"sv) set_high_speed(true);
+  else if constexpr (name == "CSL"sv) set_high_speed(false);
+
+  // block transfers
+  else if constexpr (mode == Block)
+  {
+    uint16_t source = read_word(pc + 1);
+    uint16_t destination = read_word(pc + 3);
+    uint32_t length = read_word(pc + 5);
+    if(!length)
+      length = 0x10000;
+
+    for(uint32_t count = 0; count < length; ++count)
+    {
+      uint16_t from = source;
+      uint16_t to = destination;
+      if constexpr (name == "TII"sv) { from += count; to += count; }
+      if constexpr (name == "TDD"sv) { from -= count; to -= count; }
+      if constexpr (name == "TIN"sv) { from += count; }
+      if constexpr (name == "TIA"sv) { from += count; to += count & 1; }
+      if constexpr (name == "TAI"sv) { from += count & 1; to += count; }
+      write(to, read(from));
+    }
+    add_cycles(entry.cost.per_byte * length);
+  }
+  else
+    static_assert(!entry.valid(), "opcode has no implementation");
+}
+
+#define DISPATCH_1(n)   case (n): execute<(n)>(); break;
+#define DISPATCH_4(n)   DISPATCH_1(n) DISPATCH_1((n) + 1) DISPATCH_1((n) + 2) DISPATCH_1((n) + 3)
+#define DISPATCH_16(n)  DISPATCH_4(n) DISPATCH_4((n) + 4) DISPATCH_4((n) + 8) DISPATCH_4((n) + 12)
+#define DISPATCH_64(n)  DISPATCH_16(n) DISPATCH_16((n) + 16) DISPATCH_16((n) + 32) DISPATCH_16((n) + 48)
+
+inline void huc6280_core::dispatch(uint8_t opcode)
+{
+  switch(opcode)
+  {
+    DISPATCH_64(0x00)
+    DISPATCH_64(0x40)
+    DISPATCH_64(0x80)
+    DISPATCH_64(0xC0)
+  }
+}
+
+#undef DISPATCH_64
+#undef DISPATCH_16
+#undef DISPATCH_4
+#undef DISPATCH_1
+
+uint64_t huc6280_core::step(void)
+{
+  uint64_t start = clock;
+  dispatch(read(regs.pc));
+  return clock - start;
+}
+
+uint64_t huc6280_core::run(uint64_t ticks)
+{
+  uint64_t start = clock;
+  uint64_t target = start + ticks;
+  while(clock < target)
+    dispatch(read(regs.pc));
+  return clock - start;
+}
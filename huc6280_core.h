@@ -0,0 +1,117 @@
+#ifndef HUC6280_CORE_H
+#define HUC6280_CORE_H
+
+#include "opcode_table.h"
+
+#include <cstdint>
+#include <array>
+#include <vector>
+
+// Reference HuC6280 interpreter.  Instruction sizes and cycle costs come from the opcode
+// table and each opcode's handler is specialised at compile time from its table entry.
+// Memory is a flat 2MB physical space mapped into the 64KB logical space by MPR0-7,
+// there is no I/O emulation.
+class huc6280_core
+{
+public:
+  static constexpr std::size_t physical_size = 0x200000; // 21-bit physical address space
+  static constexpr std::size_t bank_size = 0x2000;
+  static constexpr uint16_t zero_page = 0x2000;
+  static constexpr uint16_t stack_page = 0x2100;
+
+  enum status_flag : uint8_t
+  {
+    C_flag = 0x01,
+    Z_flag = 0x02,
+    I_flag = 0x04,
+    D_flag = 0x08,
+    B_flag = 0x10,
+    T_flag = 0x20,
+    V_flag = 0x40,
+    N_flag = 0x80,
+  };
+
+  enum vector_address : uint16_t
+  {
+    irq2_vector  = 0xFFF6, // also BRK
+    irq1_vector  = 0xFFF8,
+    timer_vector = 0xFFFA,
+    nmi_vector   = 0xFFFC,
+    reset_vector = 0xFFFE,
+  };
+
+  struct registers
+  {
+    uint16_t pc = 0;
+    uint8_t a = 0;
+    uint8_t x = 0;
+    uint8_t y = 0;
+    uint8_t s = 0;
+    uint8_t p = 0;
+    std::array<uint8_t, 8> mpr = {};
+  };
+
+  huc6280_core(void);
+
+  // MPR7 is set to bank zero and PC is loaded from the reset vector
+  void reset(void);
+
+  // executes whole instructions until at least the given number of 7.16MHz clock ticks have
+  // passed and returns the number that did
+  uint64_t run(uint64_t ticks);
+
+  // executes one instruction and returns the clock ticks it took
+  uint64_t step(void);
+
+  uint8_t read(uint16_t address) const
+    { return banks[address >> 13][address & (bank_size - 1)]; }
+
+  void write(uint16_t address, uint8_t value)
+    { banks[address >> 13][address & (bank_size - 1)] = value; }
+
+  void set_mpr(std::size_t bank, uint8_t value);
+
+  std::vector<uint8_t>& memory(void) { return physical; }
+  const std::vector<uint8_t>& memory(void) const { return physical; }
+
+  // CSH selects 7.16MHz, CSL selects 1.79MHz
+  void set_high_speed(bool enabled) { speed = enabled ? csh_clock : csl_clock; }
+  bool high_speed(void) const { return speed == csh_clock; }
+
+  registers regs;
+  uint64_t clock = 0;        // elapsed 7.16MHz ticks
+  uint64_t cycles = 0;       // elapsed CPU cycles at either speed
+
+private:
+  template<uint8_t opcode> void execute(void);
+
+  void dispatch(uint8_t opcode);
+
+  uint16_t read_word(uint16_t address) const
+    { return read(address) | (read(address + 1) << 8); }
+
+  uint16_t read_zp_word(uint8_t address) const
+    { return read(zero_page | address) | (read(zero_page | uint8_t(address + 1)) << 8); }
+
+  void push(uint8_t value) { write(stack_page | regs.s--, value); }
+  uint8_t pull(void) { return read(stack_page | ++regs.s); }
+
+  void set_nz(uint8_t value)
+    { regs.p = (regs.p & ~(N_flag | Z_flag)) | (value & N_flag) | (value ? 0 : Z_flag); }
+
+  void add_cycles(uint32_t count)
+  {
+    cycles += count;
+    clock += clock_ticks(count, speed);
+  }
+
+  uint8_t adc(uint8_t lhs, uint8_t rhs);
+  uint8_t sbc(uint8_t lhs, uint8_t rhs);
+  void compare(uint8_t lhs, uint8_t rhs);
+
+  std::vector<uint8_t> physical;
+  std::array<uint8_t*, 8> banks;
+  clock_speed speed = csl_clock;
+};
+
+#endif // HUC6280_CORE_H
@@ -5,12 +5,31 @@ CONFIG -= qt
 
 HEADERS += \
   build_instructions.h \
-  post_processing.h
+  compression.h \
+  cycle_cost.h \
+  html_export.h \
+  instruction_database.h \
+  json_export.h \
+  opcode_table.h \
+  post_processing.h \
+  profiler.h \
+  row_cache.h \
+  string_pool.h \
+  substitution_table.h
 
 SOURCES += \
   build_instructions.cpp \
+  compression.cpp \
+  html_export.cpp \
+  instruction_database.cpp \
+  instruction_database_writer.cpp \
+  json_export.cpp \
   main.cpp \
-  post_processing.cpp
+  post_processing.cpp \
+  profiler.cpp \
+  row_cache.cpp \
+  string_pool.cpp \
+  substitution_table.cpp
 
 DISTFILES += \
   page_header.txt
@@ -0,0 +1,102 @@
+#include "instruction_database.h"
+
+#include <bit>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std::literals::string_literals;
+
+instruction_database::instruction_database(const std::string& filename)
+{
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if(fd < 0)
+    throw "unable to open: "s + filename;
+
+  struct stat info;
+  if(::fstat(fd, &info) < 0 || info.st_size < off_t(sizeof(database::header)))
+  {
+    ::close(fd);
+    throw "not an instruction database: "s + filename;
+  }
+
+  void* mapping = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if(mapping == MAP_FAILED)
+    throw "unable to map: "s + filename;
+
+  base = static_cast<const uint8_t*>(mapping);
+  size = info.st_size;
+  try
+  {
+    validate();
+  }
+  catch(std::string message)
+  {
+    ::munmap(const_cast<uint8_t*>(base), size);
+    throw message + ": "s + filename;
+  }
+}
+
+instruction_database::~instruction_database(void)
+{
+  if(base)
+    ::munmap(const_cast<uint8_t*>(base), size);
+}
+
+// only the layout is checked, nothing is copied or converted
+void instruction_database::validate(void)
+{
+  database::header head;
+  std::memcpy(&head, base, sizeof(head));
+  if(head.magic != database::magic)
+    throw "not an instruction database"s;
+  if(head.version != database::version)
+    throw "unsupported database version "s + std::to_string(head.version);
+
+  auto fits = [this](uint64_t offset, uint64_t length) { return offset + length <= size; };
+  if(head.file_size != size ||
+     !fits(head.sections_offset, uint64_t(head.section_count) * sizeof(database::section)) ||
+     !fits(head.records_offset, uint64_t(head.record_count) * sizeof(database::record)) ||
+     !fits(head.opcode_index_offset, uint64_t(isa_count) * 256 * sizeof(uint16_t)) ||
+     !fits(head.strings_offset, head.strings_size) ||
+     head.sections_offset % alignof(database::section) ||
+     head.records_offset % alignof(database::record) ||
+     head.opcode_index_offset % alignof(uint16_t) ||
+     !head.strings_size || base[head.strings_offset + head.strings_size - 1])
+    throw "corrupt instruction database"s;
+
+  section_table = { reinterpret_cast<const database::section*>(base + head.sections_offset), head.section_count };
+  record_table = { reinterpret_cast<const database::record*>(base + head.records_offset), head.record_count };
+  opcode_index = reinterpret_cast<const uint16_t*>(base + head.opcode_index_offset);
+  strings = reinterpret_cast<const char*>(base + head.strings_offset);
+
+  for(std::size_t pos = 0; pos < std::size_t(isa_count) * 256; ++pos)
+    if(opcode_index[pos] != database::no_record && opcode_index[pos] >= head.record_count)
+      throw "corrupt opcode index"s;
+
+  auto valid = [&head](const database::string_ref& ref) { return uint64_t(ref.offset) + ref.length < head.strings_size; };
+  for(const database::section& current : section_table)
+    if(!valid(current.title) || uint64_t(current.first_record) + current.record_count > head.record_count)
+      throw "corrupt section table"s;
+  for(const database::record& current : record_table)
+  {
+    if(current.section >= head.section_count)
+      throw "corrupt record"s;
+    for(database::string_ref database::record::* member : database::record_strings)
+      if(!valid(current.*member))
+        throw "corrupt record"s;
+  }
+}
+
+const database::record* instruction_database::find(isa target, uint8_t opcode) const
+{
+  uint16_t bits = target;
+  if(!std::has_single_bit(bits) || std::countr_zero(bits) >= isa_count)
+    return nullptr;
+  uint16_t index = opcode_index[std::countr_zero(bits) * 256 + opcode];
+  return index == database::no_record ? nullptr : &record_table[index];
+}
@@ -0,0 +1,127 @@
+#ifndef INSTRUCTION_DATABASE_H
+#define INSTRUCTION_DATABASE_H
+
+#include "build_instructions.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Binary form of the post-processed instruction blocks.  Everything is a fixed-size little
+// endian record addressed by offsets from the start of the file, so a mapped file can be
+// queried in place:
+//
+//   database_header
+//   database_section[section_count]
+//   database_record[record_count]          in page order
+//   uint16_t[isa_count][256]               record index for each opcode, no_record if unassigned
+//   char[strings_size]                     NUL terminated strings
+namespace database
+{
+  constexpr std::array<char, 8> magic = { 'H', 'u', 'C', '6', '2', '8', '0', 'D' };
+  constexpr uint32_t version = 1;
+  constexpr uint16_t no_record = 0xFFFF;
+
+  struct string_ref
+  {
+    uint32_t offset;              // from the start of the string table
+    uint32_t length;              // without the NUL
+  };
+
+  struct header
+  {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t file_size;
+    uint32_t section_count;
+    uint32_t sections_offset;
+    uint32_t record_count;
+    uint32_t records_offset;
+    uint32_t opcode_index_offset;
+    uint32_t strings_offset;
+    uint32_t strings_size;
+    uint32_t reserved;
+  };
+
+  struct section
+  {
+    string_ref title;
+    uint32_t first_record;
+    uint32_t record_count;
+  };
+
+  struct record
+  {
+    uint16_t cpus;                // isa mask
+    uint8_t opcode;
+    uint8_t byte_count;
+    uint32_t mode_data;           // modes_t chain
+    uint8_t base_cycles;          // cycle_cost
+    uint8_t branch_taken_cycles;
+    uint8_t per_byte_cycles;
+    uint8_t section;
+    uint32_t instruction;         // index of the instruction within its section
+    string_ref mnemonic;          // with the "#" digit filled in
+    string_ref name;
+    string_ref mnemonic_origin;
+    string_ref pceas_syntax;
+    string_ref abstract;
+    string_ref machine_code;
+    string_ref address_mode;
+    string_ref cycles;
+    string_ref flags;             // "NVTBDIZC" style column text
+    string_ref description;
+    string_ref summary;
+    string_ref note;
+  };
+
+  static_assert(sizeof(header) == 48);
+  static_assert(sizeof(section) == 16);
+  static_assert(sizeof(record) == 112);
+
+  // every string of a record
+  constexpr std::array<string_ref record::*, 12> record_strings =
+  {
+    &record::mnemonic, &record::name, &record::mnemonic_origin, &record::pceas_syntax,
+    &record::abstract, &record::machine_code, &record::address_mode, &record::cycles,
+    &record::flags, &record::description, &record::summary, &record::note,
+  };
+
+  // the binary form of insn_blocks after post_processing()
+  std::string serialize(const std::vector<instructions>& insn_blocks);
+}
+
+// A read only view of a database file mapped into memory
+class instruction_database
+{
+public:
+  instruction_database(const std::string& filename);
+  instruction_database(const instruction_database&) = delete;
+  instruction_database& operator=(const instruction_database&) = delete;
+  ~instruction_database(void);
+
+  std::span<const database::section> sections(void) const { return section_table; }
+  std::span<const database::record> records(void) const { return record_table; }
+
+  std::string_view string(const database::string_ref& ref) const
+    { return std::string_view(strings + ref.offset, ref.length); }
+
+  // nullptr if the opcode is not assigned for target
+  const database::record* find(isa target, uint8_t opcode) const;
+
+private:
+  void validate(void);
+
+  const uint8_t* base = nullptr;
+  std::size_t size = 0;
+  std::span<const database::section> section_table;
+  std::span<const database::record> record_table;
+  const uint16_t* opcode_index = nullptr;
+  const char* strings = nullptr;
+};
+
+#endif // INSTRUCTION_DATABASE_H
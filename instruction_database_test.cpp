@@ -0,0 +1,138 @@
+#include <iostream>
+#include <format>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "build_instructions.h"
+#include "instruction_database.h"
+#include "post_processing.h"
+
+using namespace std::literals;
+
+// ----------------------------------------------------------------------------
+
+// Writes the generator's rows to a database, maps it back and checks that find() returns
+// each row for every cpu it runs on and nothing for unassigned opcodes or unknown cpus.  A
+// copy with a bad section index must be refused.
+
+static void write_file(const std::string& filename, const std::string& contents)
+{
+  std::ofstream file(filename, std::ios::binary);
+  if(!file.write(contents.data(), contents.size()))
+    throw "unable to write: "s + filename;
+}
+
+static std::size_t check_rows(const instruction_database& db, const std::vector<instructions>& insn_blocks)
+{
+  std::size_t failures = 0;
+  auto expect = [&failures](bool passed, std::string_view what, const mode_details& md, isa target)
+  {
+    if(!passed)
+    {
+      std::cerr << std::format("${:02X} on cpu {}: {} differs\n", md.opcode, uint16_t(target), what);
+      ++failures;
+    }
+  };
+
+  std::array<std::array<bool, 256>, isa_count> assigned = {};
+  for(std::size_t block = 0; block < insn_blocks.size(); ++block)
+  {
+    for(const auto& i : insn_blocks[block])
+    {
+      for(const auto& md : i.data<std::vector<mode_details>>())
+      {
+        for(int bit = 0; bit < isa_count; ++bit)
+        {
+          isa target = isa(1 << bit);
+          if(!(md.cpus & target))
+            continue;
+          assigned[bit][uint8_t(md.opcode)] = true;
+
+          const database::record* found = db.find(target, uint8_t(md.opcode));
+          expect(found, "presence", md, target);
+          if(!found)
+            continue;
+          expect(found->opcode == md.opcode, "opcode", md, target);
+          expect(found->byte_count == md.byte_count, "byte count", md, target);
+          expect(found->mode_data == md.mode_data, "mode", md, target);
+          expect(found->section == block, "section", md, target);
+          expect(found->instruction == md.parent, "instruction", md, target);
+          expect(db.string(found->mnemonic) == expanded_mnemonic(i, md), "mnemonic", md, target);
+          expect(db.string(found->name) == md.name_string, "name", md, target);
+          expect(db.string(found->pceas_syntax) == std::string_view(md.pceas_syntax_string), "syntax", md, target);
+          expect(db.string(found->abstract) == std::string_view(md.abstract_string), "abstract", md, target);
+          expect(db.string(found->flags) == build_flags(i.data<flags>()), "flags", md, target);
+          expect(db.string(found->note) == std::string_view(i.data<note>()), "note", md, target);
+          expect(db.string(db.sections()[found->section].title) == insn_blocks[block].section_title, "section title", md, target);
+        }
+      }
+    }
+  }
+
+  for(int bit = 0; bit < isa_count; ++bit)
+    for(int opcode = 0; opcode < 256; ++opcode)
+      if(!assigned[bit][opcode] && db.find(isa(1 << bit), uint8_t(opcode)))
+      {
+        std::cerr << std::format("${:02X} on cpu {}: found but unassigned\n", opcode, 1 << bit);
+        ++failures;
+      }
+
+  // a cpu bit past the opcode index
+  for(int opcode = 0; opcode < 256; ++opcode)
+    if(db.find(isa(1 << isa_count), uint8_t(opcode)))
+    {
+      std::cerr << std::format("${:02X} on cpu {}: found for an unknown cpu\n", opcode, 1 << isa_count);
+      ++failures;
+    }
+  return failures;
+}
+
+int main (int argc, char** argv)
+{
+  std::string filename = argc > 1 ? argv[1] : "instruction_database_test.db";
+  std::size_t failures = 0;
+
+  try
+  {
+    std::vector<instructions> insn_blocks;
+    build_insn_blocks(insn_blocks);
+    post_processing(insn_blocks);
+
+    std::string contents = database::serialize(insn_blocks);
+    write_file(filename, contents);
+    {
+      instruction_database db(filename);
+      failures += check_rows(db, insn_blocks);
+    }
+
+    database::header head;
+    std::memcpy(&head, contents.data(), sizeof(head));
+    database::record first;
+    std::memcpy(&first, contents.data() + head.records_offset, sizeof(first));
+    first.section = uint8_t(head.section_count);
+    std::memcpy(contents.data() + head.records_offset, &first, sizeof(first));
+    write_file(filename, contents);
+    try
+    {
+      instruction_database db(filename);
+      std::cerr << "a record with a bad section index was accepted\n";
+      ++failures;
+    }
+    catch(std::string message) { }
+  }
+  catch (std::string message)
+  {
+    std::remove(filename.c_str());
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::remove(filename.c_str());
+  std::cout << (failures ? std::format("{} failures\n", failures) : "all rows match\n"s);
+  return failures ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,132 @@
+#include "instruction_database.h"
+
+#include "opcode_table.h"
+#include "post_processing.h"
+
+#include <bit>
+#include <unordered_map>
+
+using namespace std::literals::string_literals;
+
+static_assert(std::endian::native == std::endian::little, "records are written in host byte order");
+
+namespace database
+{
+  // collects each distinct string once
+  class string_table
+  {
+  public:
+    string_table(void) { add(""); }
+
+    string_ref add(std::string_view text)
+    {
+      auto found = offsets.find(std::string(text));
+      if(found == std::end(offsets))
+      {
+        found = offsets.emplace(text, uint32_t(data.size())).first;
+        data.append(text).push_back('\0');
+      }
+      return { found->second, uint32_t(text.size()) };
+    }
+
+    const std::string& contents(void) const { return data; }
+
+  private:
+    std::string data;
+    std::unordered_map<std::string, uint32_t> offsets;
+  };
+
+  static std::string cycle_text(const snn_t& value)
+  {
+    switch(value.index())
+    {
+    case 1: return std::to_string(std::get<int>(value));
+    case 2: return std::get<std::string>(value);
+    }
+    return {};
+  }
+
+  template<typename T>
+  static void append(std::string& output, const T* data, std::size_t count)
+  {
+    output.append(reinterpret_cast<const char*>(data), sizeof(T) * count);
+  }
+
+  std::string serialize(const std::vector<instructions>& insn_blocks)
+  {
+    string_table strings;
+    std::vector<section> sections;
+    std::vector<record> records;
+    std::array<std::array<uint16_t, 256>, isa_count> opcode_index;
+    for(auto& index : opcode_index)
+      index.fill(no_record);
+
+    for(const auto& block : insn_blocks)
+    {
+      section& current = sections.emplace_back();
+      current.title = strings.add(block.section_title);
+      current.first_record = uint32_t(records.size());
+
+      for(const auto& i : block)
+      {
+        for(const auto& md : i.data<std::vector<mode_details>>())
+        {
+          if(records.size() >= opcode_rows.size())
+            throw "more mode rows than opcode_rows entries"s;
+
+          cycle_cost cost = opcode_rows[records.size()].cost();
+          for(std::size_t pos = 0; pos < isa_count; ++pos)
+            if(md.cpus & (1 << pos))
+              opcode_index[pos][uint8_t(md.opcode)] = uint16_t(records.size());
+
+          records.push_back(
+            {
+              md.cpus,
+              uint8_t(md.opcode),
+              uint8_t(md.byte_count),
+              md.mode_data,
+              cost.base,
+              cost.branch_taken,
+              cost.per_byte,
+              uint8_t(sections.size() - 1),
+              md.parent,
+              strings.add(expanded_mnemonic(i, md)),
+              strings.add(md.name_string),
+              strings.add(i.data<mnemonic_origin>()),
+              strings.add(md.pceas_syntax_string),
+              strings.add(md.abstract_string),
+              strings.add(md.machine),
+              strings.add(md.address_mode_string),
+              strings.add(cycle_text(md.cycle_count)),
+              strings.add(build_flags(i.data<flags>())),
+              strings.add(md.description_string),
+              strings.add(md.summary_string),
+              strings.add(i.data<note>()),
+            });
+        }
+      }
+      current.record_count = uint32_t(records.size() - current.first_record);
+    }
+
+    header head = {};
+    head.magic = magic;
+    head.version = version;
+    head.section_count = uint32_t(sections.size());
+    head.sections_offset = sizeof(header);
+    head.record_count = uint32_t(records.size());
+    head.records_offset = head.sections_offset + uint32_t(sizeof(section) * sections.size());
+    head.opcode_index_offset = head.records_offset + uint32_t(sizeof(record) * records.size());
+    head.strings_offset = head.opcode_index_offset + uint32_t(sizeof(opcode_index));
+    head.strings_size = uint32_t(strings.contents().size());
+    head.file_size = head.strings_offset + head.strings_size;
+
+    std::string output;
+    output.reserve(head.file_size);
+    append(output, &head, 1);
+    append(output, sections.data(), sections.size());
+    append(output, records.data(), records.size());
+    append(output, opcode_index.data(), opcode_index.size());
+    output.append(strings.contents());
+    return output;
+  }
+}
@@ -0,0 +1,79 @@
+#include "instruction_query.h"
+
+#include "mnemonic_hash.h"
+#include "post_processing.h"
+
+#include <bit>
+#include <string>
+
+using namespace std::literals::string_literals;
+
+instruction_query::instruction_query(void)
+  : processed(opcode_rows.size(), false),
+    text_processed(opcode_rows.size(), false)
+{
+  build_insn_blocks(insn_blocks);
+  for(uint32_t block = 0; block < insn_blocks.size(); ++block)
+  {
+    for(uint32_t parent = 0; parent < insn_blocks[block].size(); ++parent)
+    {
+      auto& instruction = insn_blocks[block][parent];
+      auto& rows = instruction.data<std::vector<mode_details>>();
+      if(rows.empty())
+        rows.push_back(std::move(instruction.data<mode_details>()));
+
+      uint32_t first_row = uint32_t(locations.size());
+      for(uint32_t position = 0; position < rows.size(); ++position)
+        locations.push_back({ block, parent, first_row, position });
+    }
+  }
+
+  if(locations.size() != opcode_rows.size())
+    throw "opcode_rows does not have an entry for each row of the instruction blocks"s;
+
+  for(auto& opcodes : opcode_rows_of)
+    opcodes.fill(no_row);
+  for(std::size_t row_index = 0; row_index < opcode_rows.size(); ++row_index)
+    for(int bit = 0; bit < isa_count; ++bit)
+      if(opcode_rows[row_index].cpus & (1 << bit))
+        opcode_rows_of[bit][opcode_rows[row_index].opcode] = int16_t(row_index);
+}
+
+instruction_query::row instruction_query::process(std::size_t row_index)
+{
+  const location& where = locations[row_index];
+  instruction& parent = insn_blocks[where.block][where.parent];
+  mode_details& details = parent.data<std::vector<mode_details>>()[where.position];
+  if(!processed[row_index])
+  {
+    if(!text_processed[where.first_row])
+    {
+      process_instruction_text(parent);
+      text_processed[where.first_row] = true;
+    }
+    process_mode_row(parent, where.parent, row_index, details);
+    processed[row_index] = true;
+  }
+  return { &parent, &details };
+}
+
+std::optional<instruction_query::row> instruction_query::lookup(isa target, uint8_t opcode)
+{
+  uint16_t bits = target;
+  if(!std::has_single_bit(bits) || std::countr_zero(bits) >= isa_count)
+    return std::nullopt;
+
+  int16_t row_index = opcode_rows_of[std::countr_zero(bits)][opcode];
+  if(row_index == no_row)
+    return std::nullopt;
+  return process(std::size_t(row_index));
+}
+
+std::vector<instruction_query::row> instruction_query::lookup(std::string_view op_mnemonic)
+{
+  std::vector<row> rows;
+  if(const mnemonic_span* span = find_mnemonic(op_mnemonic))
+    for(std::size_t row_index = span->first; row_index < std::size_t(span->first + span->count); ++row_index)
+      rows.push_back(process(row_index));
+  return rows;
+}
@@ -0,0 +1,56 @@
+#ifndef INSTRUCTION_QUERY_H
+#define INSTRUCTION_QUERY_H
+
+#include "build_instructions.h"
+
+#include <cstdint>
+#include <array>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+// Answers questions about single rows, such as "what is opcode $B1 on HuC6280", without
+// post-processing every instruction.  The raw instruction blocks are built once.  A lookup
+// runs post_processing() on just the rows it returns (and the name and flags of their
+// instructions) and keeps them, so asking again costs only the index lookup.  Rows are
+// processed in place, so returned pointers stay valid for the life of the query.
+class instruction_query
+{
+public:
+  struct row
+  {
+    const instruction* parent;    // name, flags and note of the instruction
+    const mode_details* details;
+  };
+
+  instruction_query(void);
+  instruction_query(const instruction_query&) = delete;
+  instruction_query& operator=(const instruction_query&) = delete;
+
+  // the row of opcode on target, nothing for an unassigned opcode
+  std::optional<row> lookup(isa target, uint8_t opcode);
+
+  // the rows of a mnemonic in page order, e.g. "lda", "BBR3" or every BBR with "BBR#"
+  std::vector<row> lookup(std::string_view op_mnemonic);
+
+private:
+  static constexpr int16_t no_row = -1;
+
+  struct location
+  {
+    uint32_t block;
+    uint32_t parent;              // instruction within the block
+    uint32_t first_row;           // opcode_rows index of the instruction's first row
+    uint32_t position;            // of this row among the instruction's rows
+  };
+
+  row process(std::size_t row_index);
+
+  std::vector<instructions> insn_blocks;
+  std::vector<location> locations;               // by opcode_rows index
+  std::vector<bool> processed;                   // by opcode_rows index
+  std::vector<bool> text_processed;              // by the first row of an instruction
+  std::array<std::array<int16_t, 256>, isa_count> opcode_rows_of = {}; // by isa bit then opcode
+};
+
+#endif // INSTRUCTION_QUERY_H
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+
+#include "instruction_query.h"
+#include "post_processing.h"
+
+using namespace std::literals;
+using namespace std::string_view_literals;
+
+// ----------------------------------------------------------------------------
+
+// "$B1" or "0xB1", -1 for anything else
+static int parse_opcode(std::string_view text)
+{
+  if(text.starts_with('$'))
+    text.remove_prefix(1);
+  else if(text.starts_with("0x"sv) || text.starts_with("0X"sv))
+    text.remove_prefix(2);
+  else
+    return -1;
+
+  char* end = nullptr;
+  std::string digits(text);
+  long value = std::strtol(digits.c_str(), &end, 16);
+  return !digits.empty() && !*end && value >= 0 && value <= 0xFF ? int(value) : -1;
+}
+
+// the text of a row as a tooltip would show it
+static std::string describe(const instruction_query::row& entry)
+{
+  const mode_details& details = *entry.details;
+  std::string cycles;
+  if(details.cycle_count.index() == 1)
+    cycles = std::to_string(std::get<int>(details.cycle_count));
+  else if(details.cycle_count.index() == 2)
+    cycles = std::get<std::string>(details.cycle_count);
+
+  std::string text = std::format("${:02X} {}\n  {}; {} bytes; {} cycles; flags {}\n  {}: {}\n  {}\n",
+                                 details.opcode, std::string_view(details.pceas_syntax_string),
+                                 std::string_view(details.address_mode_string), details.byte_count, cycles,
+                                 build_flags(entry.parent->data<flags>()),
+                                 details.name_string, details.description_string,
+                                 std::string_view(details.abstract_string));
+  if(!entry.parent->data<note>().empty())
+    text += std::format("  Note: {}\n", std::string_view(entry.parent->data<note>()));
+  return text;
+}
+
+int main (int argc, char** argv)
+{
+  std::ios::sync_with_stdio(false);
+
+  isa target = HuC6280;
+  std::vector<std::string_view> queries;
+
+  for(int pos = 1; pos < argc; ++pos)
+  {
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--isa="sv))
+      target = parse_isa(arg.substr("--isa="sv.size()));
+    else
+      queries.push_back(arg);
+  }
+
+  if(queries.empty() || target == None)
+  {
+    std::cerr << "usage: " << argv[0] << " [--isa=HuC6280|WDC65C02|NMOS6502] <$opcode|mnemonic>..." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    instruction_query query;
+    std::string output;
+    for(std::string_view text : queries)
+    {
+      std::vector<instruction_query::row> rows;
+      if(int opcode = parse_opcode(text); opcode >= 0)
+      {
+        if(auto entry = query.lookup(target, uint8_t(opcode)))
+          rows.push_back(*entry);
+      }
+      else
+        for(const auto& entry : query.lookup(text))
+          if(entry.details->cpus & target)
+            rows.push_back(entry);
+
+      if(rows.empty())
+        throw "nothing matches "s + std::string(text);
+      for(const auto& entry : rows)
+        output += describe(entry);
+    }
+    std::cout << output;
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+
+#include "instruction_query.h"
+#include "mnemonic_hash.h"
+#include "post_processing.h"
+
+using namespace std::literals;
+
+// ----------------------------------------------------------------------------
+
+// Compares every row instruction_query returns with the same row of the full
+// post_processing() pass, field for field, so process_instruction_text() and
+// process_mode_row() cannot drift from it.  Rows are looked up last to first, so an
+// instruction's text is processed for a row other than its first, and every mnemonic is
+// looked up again to check that it returns the rows already processed.
+
+static std::size_t failures = 0;
+
+static void expect(bool passed, std::string_view what, const mode_details& md)
+{
+  if(!passed && ++failures <= 20)
+    std::cerr << std::format("${:02X} on cpus {}: {} differs\n", md.opcode, uint16_t(md.cpus), what);
+}
+
+static void compare(const instruction& parent, const mode_details& md, const instruction_query::row& found)
+{
+  const mode_details& other = *found.details;
+  expect(found.parent->data<mnemonic>() == parent.data<mnemonic>(), "mnemonic", md);
+  expect(found.parent->data<name>() == parent.data<name>(), "instruction name", md);
+  expect(found.parent->data<note>() == parent.data<note>(), "note", md);
+  expect(found.parent->data<flags>() == parent.data<flags>(), "flags", md);
+  expect(build_flags(found.parent->data<flags>()) == build_flags(parent.data<flags>()), "flag text", md);
+  expect(other.cpus == md.cpus, "cpus", md);
+  expect(other.opcode == md.opcode, "opcode", md);
+  expect(other.byte_count == md.byte_count, "byte count", md);
+  expect(other.cycle_count == md.cycle_count, "cycle count", md);
+  expect(other.mode_data == md.mode_data, "mode", md);
+  expect(other.mnemonic_fill_value == md.mnemonic_fill_value, "fill value", md);
+  expect(other.abstract_string == md.abstract_string, "abstract", md);
+  expect(other.pceas_syntax_string == md.pceas_syntax_string, "syntax", md);
+  expect(other.llvm_syntax_string == md.llvm_syntax_string, "llvm syntax", md);
+  expect(other.machine == md.machine, "machine code", md);
+  expect(other.address_mode_string == md.address_mode_string, "address mode", md);
+  expect(other.parent == md.parent, "parent", md);
+  expect(other.description_string == md.description_string, "description", md);
+  expect(other.summary_string == md.summary_string, "summary", md);
+  expect(other.name_string == md.name_string, "name", md);
+  expect(expanded_mnemonic(*found.parent, other) == expanded_mnemonic(parent, md), "expanded mnemonic", md);
+}
+
+int main (void)
+{
+  std::size_t comparisons = 0;
+
+  try
+  {
+    std::vector<instructions> insn_blocks;
+    build_insn_blocks(insn_blocks);
+    post_processing(insn_blocks);
+
+    // the full pass's rows in page order
+    std::vector<std::pair<const instruction*, const mode_details*>> rows;
+    for(const auto& block : insn_blocks)
+      for(const auto& i : block)
+        for(const auto& md : i.data<std::vector<mode_details>>())
+          rows.push_back({ &i, &md });
+    if(rows.size() != opcode_rows.size())
+      throw std::format("the full pass has {} rows, opcode_rows has {}", rows.size(), opcode_rows.size());
+
+    instruction_query query;
+    std::vector<const mode_details*> found_rows(rows.size(), nullptr);
+    for(std::size_t row_index = rows.size(); row_index--; )
+    {
+      const auto& [parent, md] = rows[row_index];
+      for(int bit = 0; bit < isa_count; ++bit)
+      {
+        if(!(md->cpus & (1 << bit)))
+          continue;
+        auto found = query.lookup(isa(1 << bit), uint8_t(md->opcode));
+        expect(found.has_value(), "presence", *md);
+        if(!found)
+          continue;
+        compare(*parent, *md, *found);
+        expect(!found_rows[row_index] || found_rows[row_index] == found->details, "row identity", *md);
+        found_rows[row_index] = found->details;
+        ++comparisons;
+      }
+    }
+
+    // every key of the mnemonic hash, "BBR#" as well as "BBR3"
+    for(const auto& span : mnemonic_spans)
+    {
+      std::string key;
+      for(uint32_t packed = span.key; packed; packed >>= 8)
+        key.push_back(char(packed & 0xFF));
+      std::vector<instruction_query::row> found = query.lookup(key);
+      expect(found.size() == span.count, std::format("row count of {}", key), *rows[span.first].second);
+      for(std::size_t pos = 0; pos < found.size() && pos < span.count; ++pos)
+      {
+        std::size_t row_index = span.first + pos;
+        compare(*rows[row_index].first, *rows[row_index].second, found[pos]);
+        expect(found[pos].details == found_rows[row_index], "row identity", *rows[row_index].second);
+        ++comparisons;
+      }
+    }
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << (failures ? std::format("{} fields differ\n", failures) : std::format("all {} rows match\n", comparisons));
+  return failures ? EXIT_FAILURE : 0;
+}
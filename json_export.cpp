@@ -0,0 +1,115 @@
+#include "json_export.h"
+
+#include "opcode_table.h"
+#include "post_processing.h"
+
+#include <array>
+#include <string_view>
+
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+// string with JSON escapes, dropping the <em> markup used on the page
+static void append_string(std::string& output, std::string_view text)
+{
+  constexpr std::string_view hex = "0123456789abcdef";
+
+  output.push_back('"');
+  for(std::size_t pos = 0; pos < text.size(); ++pos)
+  {
+    char c = text[pos];
+    if(c == '<' && (text.substr(pos).starts_with("<em>"sv) || text.substr(pos).starts_with("</em>"sv)))
+    {
+      pos = text.find('>', pos);
+      continue;
+    }
+
+    switch(c)
+    {
+    case '"':  output.append("\\\""); break;
+    case '\\': output.append("\\\\"); break;
+    case '\n': output.append("\\n"); break;
+    case '\t': output.append("\\t"); break;
+    default:
+      if(uint8_t(c) < 0x20)
+        output.append("\\u00").append(1, hex[c >> 4]).append(1, hex[c & 0xF]);
+      else
+        output.push_back(c);
+    }
+  }
+  output.push_back('"');
+}
+
+static void append_cycles(std::string& output, const snn_t& value)
+{
+  switch(value.index())
+  {
+  case 0: output.append("null"); break;
+  case 1: output.append(std::to_string(std::get<int>(value))); break;
+  case 2: append_string(output, std::get<std::string>(value)); break;
+  }
+}
+
+void export_json(std::string& output, const std::vector<instructions>& insn_blocks, bool newline_delimited)
+{
+  std::size_t row_index = 0;
+  if(!newline_delimited)
+    output.append("[\n");
+
+  for(const auto& block : insn_blocks)
+  {
+    for(const auto& i : block)
+    {
+      for(const auto& md : i.data<std::vector<mode_details>>())
+      {
+        if(row_index >= opcode_rows.size())
+          throw "more mode rows than opcode_rows entries"s;
+        cycle_cost cost = opcode_rows[row_index].cost();
+
+        if(row_index++ && !newline_delimited)
+          output.append(",\n");
+
+        output.append("{\"name\":");
+        append_string(output, md.name_string);
+        output.append(",\"mnemonic\":");
+        append_string(output, expanded_mnemonic(i, md));
+        output.append(",\"mnemonic_origin\":");
+        append_string(output, i.data<mnemonic_origin>());
+        output.append(",\"section\":");
+        append_string(output, block.section_title);
+        output.append(",\"opcode\":").append(std::to_string(md.opcode))
+              .append(",\"bytes\":").append(std::to_string(md.byte_count))
+              .append(",\"cycles\":");
+        append_cycles(output, md.cycle_count);
+        output.append(",\"cycle_cost\":{\"base\":").append(std::to_string(cost.base))
+              .append(",\"branch_taken\":").append(std::to_string(cost.branch_taken))
+              .append(",\"per_byte\":").append(std::to_string(cost.per_byte))
+              .append("},\"flags\":");
+        append_string(output, build_flags(i.data<flags>()));
+        output.append(",\"isa_mask\":").append(std::to_string(md.cpus))
+              .append(",\"isa\":[");
+        bool first = true;
+        for(std::size_t pos = 0; pos < isa_names.size(); ++pos)
+        {
+          if(md.cpus & (1 << pos))
+          {
+            if(!first)
+              output.push_back(',');
+            append_string(output, isa_names[pos]);
+            first = false;
+          }
+        }
+        output.append("],\"addressing_mode\":");
+        append_string(output, md.address_mode_string);
+        output.append(",\"pceas_syntax\":");
+        append_string(output, md.pceas_syntax_string);
+        output.append("}");
+        if(newline_delimited)
+          output.push_back('\n');
+      }
+    }
+  }
+
+  if(!newline_delimited)
+    output.append("\n]\n");
+}
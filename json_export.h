@@ -0,0 +1,13 @@
+#ifndef JSON_EXPORT_H
+#define JSON_EXPORT_H
+
+#include "build_instructions.h"
+
+#include <string>
+#include <vector>
+
+// Appends one JSON object per mode row of the post-processed instruction blocks to output,
+// either as a single array or as newline delimited records.
+void export_json(std::string& output, const std::vector<instructions>& insn_blocks, bool newline_delimited);
+
+#endif // JSON_EXPORT_H
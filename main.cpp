@@ -4,11 +4,19 @@
 #include <iomanip>
 #include <string_view>
 #include <cstring>
+#include <cstdlib>
 #include <regex>
 #include <algorithm>
+#include <filesystem>
 
 #include "build_instructions.h"
+#include "compression.h"
 #include "post_processing.h"
+#include "instruction_database.h"
+#include "html_export.h"
+#include "json_export.h"
+#include "profiler.h"
+#include "row_cache.h"
 
 using namespace std::literals;
 using namespace std::string_view_literals;
@@ -26,210 +34,230 @@ static isa_property display_name = isa_property
 
 // ----------------------------------------------------------------------------
 
-std::string fix_id(std::string data)
+std::string regex_property_list(const isa_property& prop, const std::string& newtext)
 {
-  data = std::regex_replace(data, std::regex("<var[^>]+>([^<]+)</var>", std::regex_constants::extended),
-                            "\\1", std::regex_constants::format_sed);
-
-  data = std::regex_replace(data, std::regex("[[:space:]]", std::regex_constants::extended),
-                            "", std::regex_constants::format_sed);
-  data = "code" + data;
-  return data;
+  std::string r;
+  for(const auto& val : prop)
+    if(!val.empty())
+      r += std::regex_replace(std::string(val), std::regex(std::begin(val), std::end(val), std::regex_constants::basic), newtext, std::regex_constants::format_sed);
+  return r;
 }
 
-// ----------------------------------------------------------------------------
 
-std::string build_flags(const flags& farr)
+void build_page_header(std::string& document)
 {
-  constexpr const char* const flag_ids = "NVTBDIZC";
-
-  std::string rval;
-  int idx = 0;
-  for(auto& val : farr)
+  std::string page_header(_binary_page_header_txt_start);
+  /*
   {
-    switch(val.index())
-    {
-    case 0:
-      rval.push_back('-');
-      break;
-    case 1:
-      rval.push_back(std::get<int>(val) ? '1' : '0');
-      break;
-    case 2:
-      rval.push_back(flag_ids[idx]);
-    }
-    idx++;
+    std::cerr << QUOTE(PROJECT_DIR) << std::endl;
+    std::filesystem::current_path(QUOTE(PROJECT_DIR));
+    std::ifstream page_header_file("page_header.txt");
+    page_header = std::string((std::istreambuf_iterator<char>(page_header_file)), (std::istreambuf_iterator<char>())); // copy file contents
+    page_header_file.close();;
   }
-  return rval;
-}
+  */
+  page_header.replace(page_header.find("__DATE__"), sizeof(R"(__DATE__)"), __DATE__);
+  page_header.replace(page_header.find("__TIME__"), sizeof(R"(__TIME__)"), __TIME__);
 
-std::string build_span_section (std::string_view word_title, std::string tag_title, std::string val)
-{
-  std::string rval;
-  if(!val.empty())
-  {
-    rval.append("<span title=\"section\">")
-        .append(word_title)
-        .append("</span>\n")
-        .append("<span title=\"")
-        .append(tag_title)
-        .append("\">")
-        .append(val)
-        .append("</span>\n");
-  }
-  return rval;
+  document.reserve(page_header.size() + 256 * 1024);
+  document.append(page_header)
+          .append(regex_property_list(display_name, "\n  <input type=\"checkbox\" id=\"cb_&\" name=\"&\" checked /><label for=\"cb_&\">&</label>"))
+          .append(R"html(<br />
+    <span id="table_header" class="summary)html").append(regex_property_list(display_name, " &")).append(R"html(">
+    <span>Compatibilty</span>
+    <span>PCEAS Syntax</span>
+    <span>Abstract</span>
+    <span>Machine Code</span>
+    <span>Status Flags</span>
+    <span>Addressing Mode</span>
+  </span>)html");
 }
 
-
-std::string regex_property_list(const isa_property& prop, const std::string& newtext)
+// writes the whole document with as few system calls as the stream allows
+void write_document(std::ostream& out, std::string_view document)
 {
-  std::string r;
-  for(const auto& val : prop)
-    if(!val.empty())
-      r += std::regex_replace(std::string(val), std::regex(std::begin(val), std::end(val), std::regex_constants::basic), newtext, std::regex_constants::format_sed);
-  return r;
+  out.write(document.data(), document.size());
+  out.flush();
 }
 
-
-std::string build_isa_list (const mode_details& md)
+static void write_file(const std::string& filename, std::string_view data)
 {
-  static isa_property names = isa_property
-  {
-    NMOS6502, "NMOS6502",
-    WDC65C02, "WDC65C02",
-    HuC6280, "HuC6280",
-  };
-  constexpr static const std::array<isa, isa_count> list = { NMOS6502,
-                                                             WDC65C02,
-                                                             HuC6280 };
-  auto func = [](bool match, const std::string_view& prop) -> std::string
-  {
-    if(match)
-      return std::string(" ").append(prop);
-    return std::string();
-  };
-  std::string r;
-  for(std::size_t pos = 0; pos < list.size(); ++pos)
-    r += func(md.cpus & list[pos], names[list[pos]]);
-  return r;
+  std::ofstream fileOut(filename, std::ios::binary);
+  if(!fileOut.write(data.data(), data.size()))
+    throw "unable to write: "s + filename;
 }
 
-std::string build_isa_tagged_property_list (const mode_details& md, const isa_property& p)
+// copies for servers that send precompressed files as they are
+static void write_precompressed(const std::string& filename, std::string_view data)
 {
-  constexpr static const std::array<isa, isa_count> list = { NMOS6502,
-                                                             WDC65C02,
-                                                             HuC6280 };
-  auto func = [](bool match, const std::string_view& prop) -> std::string
+  for(auto [extension, encode] : { std::pair { ".gz"sv, &compression::gzip }, std::pair { ".br"sv, &compression::brotli } })
   {
-    if(match && !prop.empty())
-      return std::string("<var>").append(prop).append("</var>");
-    return "<var></var>";
-  };
-  std::string r;
-  for(std::size_t pos = 0; pos < list.size(); ++pos)
-    r += func(md.cpus & list[pos], p[list[pos]]);
-  return r;
+    profiler::scoped_timer timer(profiler::register_phase(extension == ".gz"sv ? "gzip" : "brotli"));
+    write_file(filename + std::string(extension), encode(data));
+  }
 }
 
+enum output_format
+{
+  html_format,
+  json_format,
+  ndjson_format,
+};
 
 int main (int argc, char** argv)
 {
-  std::cout << std::unitbuf; // enable automatic flushing
-  std::cerr << std::unitbuf; // enable automatic flushing
-
-  //std::cout << "data: " << _binary_page_header_txt_size << std::endl;
+  std::ios::sync_with_stdio(false); // let large writes go straight to the file descriptor
 
   std::ofstream fileOut;
-
-  if(argc == 2)
+  std::ostream* out = &std::cout;
+  std::string database_filename;
+  std::string cache_filename;
+  std::string output_filename;
+  bool precompress = false;
+  bool split_page = false;
+  output_format format = html_format;
+  unsigned int jobs = 0;
+
+  for(int pos = 1; pos < argc; ++pos)
   {
-    std::cout << "output file: " << argv[1] << std::endl;
-    fileOut.open(argv[1]);
-    std::cout.rdbuf(fileOut.rdbuf());
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--database="sv))
+      database_filename = arg.substr("--database="sv.size());
+    else if(arg.starts_with("--row-cache="sv))
+      cache_filename = arg.substr("--row-cache="sv.size());
+    else if(arg.starts_with("--jobs="sv))
+      jobs = std::atoi(argv[pos] + "--jobs="sv.size());
+    else if(arg == "--split-page"sv)
+      split_page = true;
+    else if(arg == "--precompress"sv)
+      precompress = true;
+    else if(arg == "--profile"sv)
+      profiler::enabled = true;
+    else if(arg == "--format=html"sv)
+      format = html_format;
+    else if(arg == "--format=json"sv)
+      format = json_format;
+    else if(arg == "--format=ndjson"sv)
+      format = ndjson_format;
+    else if(arg.starts_with("--format="sv))
+    {
+      std::cerr << "unknown output format: " << arg.substr("--format="sv.size()) << std::endl;
+      return EXIT_FAILURE;
+    }
+    else if(!fileOut.is_open())
+    {
+      std::cout << "output file: " << arg << std::endl;
+      fileOut.open(argv[pos], std::ios::binary);
+      out = &fileOut;
+      output_filename = arg;
+    }
   }
 
-  std::string page_header(_binary_page_header_txt_start);
-  /*
+  if(precompress && output_filename.empty())
   {
-    std::cerr << QUOTE(PROJECT_DIR) << std::endl;
-    std::filesystem::current_path(QUOTE(PROJECT_DIR));
-    std::ifstream page_header_file("page_header.txt");
-    page_header = std::string((std::istreambuf_iterator<char>(page_header_file)), (std::istreambuf_iterator<char>())); // copy file contents
-    page_header_file.close();;
+    std::cerr << "--precompress needs an output file" << std::endl;
+    return EXIT_FAILURE;
   }
-  */
-  page_header.replace(page_header.find("__DATE__"), sizeof(R"(__DATE__)"), __DATE__);
-  page_header.replace(page_header.find("__TIME__"), sizeof(R"(__TIME__)"), __TIME__);
-
-  std::cout << page_header
 
-  << regex_property_list(display_name, "\n  <input type=\"checkbox\" id=\"cb_&\" name=\"&\" checked /><label for=\"cb_&\">&</label>")
+  if(split_page && (output_filename.empty() || format != html_format))
+  {
+    std::cerr << "--split-page needs an output file and the html format" << std::endl;
+    return EXIT_FAILURE;
+  }
 
-  << R"html(<br />
-    <span id="table_header" class="summary)html" << regex_property_list(display_name, " &") << R"html(">
-    <span>Compatibilty</span>
-    <span>PCEAS Syntax</span>
-    <span>Abstract</span>
-    <span>Machine Code</span>
-    <span>Status Flags</span>
-    <span>Addressing Mode</span>
-  </span>)html";
+  // the whole output is rendered here and written at the end
+  std::string document;
+  if(format == html_format)
+  {
+    profiler::scoped_timer timer(profiler::register_phase("html emission"));
+    build_page_header(document);
+  }
 
   try
   {
-    std::list<instructions> insn_blocks;
-    build_insn_blocks(insn_blocks);
-    post_processing(insn_blocks);
+    std::vector<instructions> insn_blocks;
+    {
+      profiler::scoped_timer timer(profiler::register_phase("build_insn_blocks"));
+      build_insn_blocks(insn_blocks);
+    }
+    if(cache_filename.empty())
+      post_processing(insn_blocks, jobs);
+    else
+    {
+      row_cache cache(cache_filename);
+      post_processing(insn_blocks, jobs, &cache);
+      cache.save();
+    }
+
+    if(!database_filename.empty())
+    {
+      profiler::scoped_timer timer(profiler::register_phase("database"));
+      std::ofstream databaseOut(database_filename, std::ios::binary);
+      std::string database = database::serialize(insn_blocks);
+      if(!databaseOut.write(database.data(), database.size()))
+        throw "unable to write: "s + database_filename;
+    }
 
-    int id = 0;
-    for (const auto& block : insn_blocks)
+    if(format == html_format)
     {
-      std::cout << "<span class=\"section_title\">" << block.section_title << "</span>" << std::endl;
+      std::vector<std::string> fragments;
+      {
+        profiler::scoped_timer timer(profiler::register_phase("html emission"));
+        build_page_rows(document, insn_blocks, split_page ? &fragments : nullptr);
+      }
 
-      for (const auto& i : block)
+      // fragment paths in the page are relative to it
+      if(split_page)
       {
-        for (const auto& md : i.data<std::list<mode_details>>())
+        profiler::scoped_timer timer(profiler::register_phase("write"));
+        std::filesystem::path directory = std::filesystem::path(output_filename).parent_path();
+        std::error_code error;
+        std::filesystem::create_directories(directory / "fragments", error);
+        if(error)
+          throw "unable to create: "s + (directory / "fragments").string();
+        for(std::size_t pos = 0; pos < fragments.size(); ++pos)
         {
-          std::cout << "<input name=\"instruction\" type=\"radio\" id=\"row" << id << "\" />" << std::endl;
-          std::cout
-              << "<label class=\"summary" << build_isa_list(md) << "\" for=\"row" << id << "\">" << std::endl
-              << "<span class=\"cpu_grid\"><var></var><var></var><var></var></span>" << std::endl
-              << "<span>" << md.pceas_syntax_string << "</span>" << std::endl
-              << "<span>" << md.abstract_string << "</span>" << std::endl
-              << "<span id=\"" << fix_id(md.machine) << "\" class=\"colorized\">" << md.machine << "</span>" << std::endl
-              << "<span>" << build_flags(i.data<flags>()) << "</span>" << std::endl
-              << "<span>" << md.address_mode_string << "</span>" << std::endl
-  //            << "<span class=\"cycle_grid\">" << build_isa_tagged_property_list (i, i.data<group>()) << "</span>" << std::endl
-  //            << "<span class=\"cycle_grid\">" << build_isa_tagged_property_list (i, i.data<issue>()) << "</span>" << std::endl
-  //            << "<span class=\"cycle_grid\">" << build_isa_tagged_property_list (i, i.data<latency>()) << "</span>" << std::endl
-              << "<span class=\"details\">" << std::endl;
-
-  //        std::cout << build_environments (i.data<environments>());
-  //        std::cout << build_citations (i.data<citations>());
-          std::cout << build_span_section (md.name_string, "summary", md.description_string);
-          std::cout << build_span_section ("Note", "note", i.data<note>());
-  //        std::cout << build_span_section ("Operation", "operation", i.data<operation>());
-  //        std::cout << build_span_section ("Example", "assembly", i.data<example>());
-  //        std::cout << build_span_section ("Possible Exceptions", "list", i.data<exceptions>());
-
-          std::cout << "</span>" << std::endl // close "details"
-                    << "</label>" << std::endl;
-          ++id;
+          std::string filename = (directory / fragment_filename(insn_blocks[pos].section_title)).string();
+          write_file(filename, fragments[pos]);
+          if(precompress)
+            write_precompressed(filename, fragments[pos]);
         }
       }
     }
-
-    std::cout << "</body>" << std::endl
-              << "</html>" << std::endl;
+    else
+    {
+      profiler::scoped_timer timer(profiler::register_phase("json emission"));
+      export_json(document, insn_blocks, format == ndjson_format);
+    }
   }
   catch (std::string message)
   {
     std::cerr << "exception caught: " << message << std::endl;
   }
 
+  {
+    profiler::scoped_timer timer(profiler::register_phase("write"));
+    write_document(*out, document); // anything rendered before an exception is still written
+  }
+
   if(fileOut.is_open())
     fileOut.close();
 
+  if(precompress)
+  {
+    try
+    {
+      write_precompressed(output_filename, document);
+    }
+    catch (std::string message)
+    {
+      std::cerr << "exception caught: " << message << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  if(profiler::enabled)
+    profiler::report(std::cerr);
+
   return 0;
 }
-
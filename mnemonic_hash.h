@@ -0,0 +1,173 @@
+#ifndef MNEMONIC_HASH_H
+#define MNEMONIC_HASH_H
+
+#include "opcode_table.h"
+
+#include <cstdint>
+#include <array>
+#include <string_view>
+
+// Perfect hash from a mnemonic to its rows of opcode_rows, built at compile time.  A
+// mnemonic of up to four characters is packed into a 32-bit key and one multiply-shift
+// picks its slot, so a lookup is a multiply, two loads and a compare.  The "#" families
+// ("BBR#", "BBS#", "RMB#", "SMB#") are keys of their own spanning every numbered row.
+
+// uppercased characters in little endian order, zero when the text cannot be a mnemonic
+constexpr uint32_t pack_mnemonic(std::string_view text)
+{
+  if(text.empty() || text.size() > 4)
+    return 0;
+  uint32_t key = 0;
+  for(std::size_t pos = 0; pos < text.size(); ++pos)
+  {
+    char c = text[pos];
+    if(c >= 'a' && c <= 'z')
+      c = char(c - 'a' + 'A');
+    key |= uint32_t(uint8_t(c)) << (8 * pos);
+  }
+  return key;
+}
+
+// "BBR3" belongs to "BBR#"
+constexpr uint32_t mnemonic_family(std::string_view mnemonic)
+{
+  if(mnemonic.size() != 4 || mnemonic[3] < '0' || mnemonic[3] > '9')
+    return 0;
+  return pack_mnemonic(mnemonic.substr(0, 3)) | uint32_t('#') << 24;
+}
+
+// opcode_rows[first] to opcode_rows[first + count - 1]
+struct mnemonic_span
+{
+  uint32_t key;
+  uint8_t first;
+  uint8_t count;
+};
+
+constexpr std::size_t count_mnemonic_keys(void)
+{
+  std::size_t count = 0;
+  for(std::size_t pos = 0; pos < opcode_rows.size(); ++pos)
+  {
+    std::string_view name = opcode_rows[pos].mnemonic;
+    if(!pos || opcode_rows[pos - 1].mnemonic != name)
+      ++count;
+    // a family is counted at its first member
+    if(mnemonic_family(name) && (!pos || mnemonic_family(opcode_rows[pos - 1].mnemonic) != mnemonic_family(name)))
+      ++count;
+  }
+  return count;
+}
+
+// in opcode_rows order with each family right after its first member
+constexpr std::array<mnemonic_span, count_mnemonic_keys()> build_mnemonic_spans(void)
+{
+  std::array<mnemonic_span, count_mnemonic_keys()> spans = {};
+  std::size_t count = 0;
+  for(std::size_t pos = 0; pos < opcode_rows.size(); ++pos)
+  {
+    std::string_view name = opcode_rows[pos].mnemonic;
+    if(!pos || opcode_rows[pos - 1].mnemonic != name)
+      spans[count++] = { pack_mnemonic(name), uint8_t(pos), 0 };
+    ++spans[count - 1].count;
+
+    uint32_t family = mnemonic_family(name);
+    if(family && (!pos || mnemonic_family(opcode_rows[pos - 1].mnemonic) != family))
+    {
+      uint8_t length = 0;
+      while(pos + length < opcode_rows.size() && mnemonic_family(opcode_rows[pos + length].mnemonic) == family)
+        ++length;
+      spans[count++] = { family, uint8_t(pos), length };
+    }
+  }
+  return spans;
+}
+
+inline constexpr std::array<mnemonic_span, count_mnemonic_keys()> mnemonic_spans = build_mnemonic_spans();
+
+// every key once, so the rows of a mnemonic (and of a family) are contiguous
+constexpr bool mnemonic_rows_are_grouped(void)
+{
+  std::size_t rows = 0;
+  for(std::size_t pos = 0; pos < mnemonic_spans.size(); ++pos)
+  {
+    for(std::size_t other = 0; other < pos; ++other)
+      if(mnemonic_spans[other].key == mnemonic_spans[pos].key)
+        return false;
+    if(mnemonic_spans[pos].key >> 24 != '#')
+      rows += mnemonic_spans[pos].count;
+  }
+  return rows == opcode_rows.size();
+}
+
+static_assert(opcode_rows.size() <= 0xFF, "mnemonic_span cannot index opcode_rows");
+static_assert(mnemonic_rows_are_grouped(), "the rows of a mnemonic are not next to each other in opcode_rows");
+
+// 1024 slots so a multiplier is found within a few hundred tries
+inline constexpr int mnemonic_hash_bits = 10;
+inline constexpr uint8_t empty_mnemonic_slot = 0xFF;
+static_assert(mnemonic_spans.size() < empty_mnemonic_slot);
+
+constexpr uint32_t mnemonic_slot(uint32_t key, uint32_t multiplier)
+{
+  return (key * multiplier) >> (32 - mnemonic_hash_bits);
+}
+
+// the first odd multiplier of a fixed sequence that gives every key its own slot, zero if none does
+constexpr uint32_t find_mnemonic_multiplier(void)
+{
+  uint32_t multiplier = 0x9E3779B1;
+  for(int attempt = 0; attempt < 0x10000; ++attempt)
+  {
+    std::array<bool, 1 << mnemonic_hash_bits> taken = {};
+    bool collision = false;
+    for(const mnemonic_span& span : mnemonic_spans)
+    {
+      bool& slot = taken[mnemonic_slot(span.key, multiplier)];
+      collision |= slot;
+      slot = true;
+    }
+    if(!collision)
+      return multiplier;
+    multiplier = (multiplier + 0x6A09E668) | 1;
+  }
+  return 0;
+}
+
+inline constexpr uint32_t mnemonic_multiplier = find_mnemonic_multiplier();
+static_assert(mnemonic_multiplier, "no multiplier hashes the mnemonics without a collision");
+
+// index into mnemonic_spans of the key in each slot
+constexpr std::array<uint8_t, 1 << mnemonic_hash_bits> build_mnemonic_slots(void)
+{
+  std::array<uint8_t, 1 << mnemonic_hash_bits> slots = {};
+  for(uint8_t& slot : slots)
+    slot = empty_mnemonic_slot;
+  for(std::size_t pos = 0; pos < mnemonic_spans.size(); ++pos)
+    slots[mnemonic_slot(mnemonic_spans[pos].key, mnemonic_multiplier)] = uint8_t(pos);
+  return slots;
+}
+
+inline constexpr std::array<uint8_t, 1 << mnemonic_hash_bits> mnemonic_slots = build_mnemonic_slots();
+
+// index into mnemonic_spans, or -1 for a name that is not in opcode_rows
+constexpr int mnemonic_index(std::string_view name)
+{
+  uint32_t key = pack_mnemonic(name);
+  uint8_t index = mnemonic_slots[mnemonic_slot(key, mnemonic_multiplier)];
+  if(index == empty_mnemonic_slot || mnemonic_spans[index].key != key)
+    return -1;
+  return index;
+}
+
+constexpr const mnemonic_span* find_mnemonic(std::string_view name)
+{
+  int index = mnemonic_index(name);
+  return index < 0 ? nullptr : &mnemonic_spans[std::size_t(index)];
+}
+
+static_assert(find_mnemonic("lda") && opcode_rows[find_mnemonic("LDA")->first].mnemonic == "LDA");
+static_assert(find_mnemonic("BBR#") && find_mnemonic("BBR#")->count == 8);
+static_assert(!find_mnemonic("LDZ") && !find_mnemonic("") && !find_mnemonic("LDAXY"));
+
+#endif // MNEMONIC_HASH_H
@@ -0,0 +1,478 @@
+#ifndef OPCODE_TABLE_H
+#define OPCODE_TABLE_H
+
+#include "build_instructions.h"
+#include "cycle_cost.h"
+
+#include <cstdint>
+#include <array>
+#include <string_view>
+
+// The numbers of every mode row of build_insn_blocks(), in page order.  The instruction blocks
+// only name the cpus and opcode of each row and take the rest from here, so this is the one copy.
+struct opcode_row
+{
+  std::string_view mnemonic;  // "#" families are expanded, e.g. "BBR3"
+  isa cpus;
+  uint8_t opcode;
+  uint8_t byte_count;
+  uint8_t cycle_count;        // base cycles
+  modes_t mode_data;
+
+  constexpr cycle_cost cost(void) const
+    { return make_cycle_cost(mnemonic, cycle_count, mode_data); }
+};
+
+static constexpr std::array<opcode_row, 234> opcode_rows =
+{
+  {
+    // Branching Operations
+    { "BRA", WDC65C02 | HuC6280, 0x80, 2, 4, Relative },
+    { "JMP", NMOS6502 | WDC65C02 | HuC6280, 0x4C, 3, 4, Absolute },
+    { "JMP", NMOS6502 | WDC65C02 | HuC6280, 0x6C, 3, 7, Absolute | Indirect },
+    { "JMP", WDC65C02 | HuC6280, 0x7C, 3, 7, Absolute | X_Indexed | Indirect },
+    { "BVS", NMOS6502 | WDC65C02 | HuC6280, 0x70, 2, 2, Relative },
+    { "BVC", NMOS6502 | WDC65C02 | HuC6280, 0x50, 2, 2, Relative },
+    { "BCS", NMOS6502 | WDC65C02 | HuC6280, 0xB0, 2, 2, Relative },
+    { "BCC", NMOS6502 | WDC65C02 | HuC6280, 0x90, 2, 2, Relative },
+    { "BEQ", NMOS6502 | WDC65C02 | HuC6280, 0xF0, 2, 2, Relative },
+    { "BNE", NMOS6502 | WDC65C02 | HuC6280, 0xD0, 2, 2, Relative },
+    { "BMI", NMOS6502 | WDC65C02 | HuC6280, 0x30, 2, 2, Relative },
+    { "BPL", NMOS6502 | WDC65C02 | HuC6280, 0x10, 2, 2, Relative },
+    { "BBR0", WDC65C02 | HuC6280, 0x0F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBR1", WDC65C02 | HuC6280, 0x1F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBR2", WDC65C02 | HuC6280, 0x2F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBR3", WDC65C02 | HuC6280, 0x3F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBR4", WDC65C02 | HuC6280, 0x4F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBR5", WDC65C02 | HuC6280, 0x5F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBR6", WDC65C02 | HuC6280, 0x6F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBR7", WDC65C02 | HuC6280, 0x7F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBS0", WDC65C02 | HuC6280, 0x8F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBS1", WDC65C02 | HuC6280, 0x9F, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBS2", WDC65C02 | HuC6280, 0xAF, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBS3", WDC65C02 | HuC6280, 0xBF, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBS4", WDC65C02 | HuC6280, 0xCF, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBS5", WDC65C02 | HuC6280, 0xDF, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBS6", WDC65C02 | HuC6280, 0xEF, 3, 6, ZeroPage | Secondary | Relative },
+    { "BBS7", WDC65C02 | HuC6280, 0xFF, 3, 6, ZeroPage | Secondary | Relative },
+    // Subroutine Operations
+    { "BSR", HuC6280, 0x44, 2, 8, Relative },
+    { "JSR", NMOS6502 | WDC65C02 | HuC6280, 0x20, 3, 7, Absolute },
+    { "RTS", NMOS6502 | WDC65C02 | HuC6280, 0x60, 1, 7, Implied },
+    // Interrupt Operations
+    { "BRK", NMOS6502 | WDC65C02 | HuC6280, 0x00, 1, 8, Implied },
+    { "RTI", NMOS6502 | WDC65C02 | HuC6280, 0x40, 1, 7, Implied },
+    // Data Transfer Operations
+    { "LDA", NMOS6502 | WDC65C02 | HuC6280, 0xA9, 2, 2, Immediate },
+    { "LDA", NMOS6502 | WDC65C02 | HuC6280, 0xA5, 2, 4, ZeroPage },
+    { "LDA", NMOS6502 | WDC65C02 | HuC6280, 0xB5, 2, 4, ZeroPage | X_Indexed },
+    { "LDA", WDC65C02 | HuC6280, 0xB2, 2, 7, ZeroPage | Indirect },
+    { "LDA", NMOS6502 | WDC65C02 | HuC6280, 0xA1, 2, 7, ZeroPage | X_Indexed | Indirect },
+    { "LDA", NMOS6502 | WDC65C02 | HuC6280, 0xB1, 2, 7, ZeroPage | Indirect | Y_Indexed },
+    { "LDA", NMOS6502 | WDC65C02 | HuC6280, 0xAD, 3, 5, Absolute },
+    { "LDA", NMOS6502 | WDC65C02 | HuC6280, 0xBD, 3, 5, Absolute | X_Indexed },
+    { "LDA", NMOS6502 | WDC65C02 | HuC6280, 0xB9, 3, 5, Absolute | Y_Indexed },
+    { "LDX", NMOS6502 | WDC65C02 | HuC6280, 0xA2, 2, 2, Immediate },
+    { "LDX", NMOS6502 | WDC65C02 | HuC6280, 0xA6, 2, 4, ZeroPage },
+    { "LDX", NMOS6502 | WDC65C02 | HuC6280, 0xB6, 2, 4, ZeroPage | Y_Indexed },
+    { "LDX", NMOS6502 | WDC65C02 | HuC6280, 0xAE, 3, 5, Absolute },
+    { "LDX", NMOS6502 | WDC65C02 | HuC6280, 0xBE, 3, 5, Absolute | Y_Indexed },
+    { "LDY", NMOS6502 | WDC65C02 | HuC6280, 0xA0, 2, 2, Immediate },
+    { "LDY", NMOS6502 | WDC65C02 | HuC6280, 0xA4, 2, 4, ZeroPage },
+    { "LDY", NMOS6502 | WDC65C02 | HuC6280, 0xB4, 2, 4, ZeroPage | X_Indexed },
+    { "LDY", NMOS6502 | WDC65C02 | HuC6280, 0xAC, 3, 5, Absolute },
+    { "LDY", NMOS6502 | WDC65C02 | HuC6280, 0xBC, 3, 5, Absolute | X_Indexed },
+    { "ST0", HuC6280, 0x03, 2, 5, Immediate | Implied },
+    { "ST1", HuC6280, 0x13, 2, 5, Immediate | Implied },
+    { "ST2", HuC6280, 0x23, 2, 5, Immediate | Implied },
+    { "STA", NMOS6502 | WDC65C02 | HuC6280, 0x85, 2, 4, ZeroPage },
+    { "STA", NMOS6502 | WDC65C02 | HuC6280, 0x95, 2, 4, ZeroPage | X_Indexed },
+    { "STA", WDC65C02 | HuC6280, 0x92, 2, 7, ZeroPage | Indirect },
+    { "STA", NMOS6502 | WDC65C02 | HuC6280, 0x81, 2, 7, ZeroPage | X_Indexed | Indirect },
+    { "STA", NMOS6502 | WDC65C02 | HuC6280, 0x91, 2, 7, ZeroPage | Indirect | Y_Indexed },
+    { "STA", NMOS6502 | WDC65C02 | HuC6280, 0x8D, 3, 5, Absolute },
+    { "STA", NMOS6502 | WDC65C02 | HuC6280, 0x9D, 3, 5, Absolute | X_Indexed },
+    { "STA", NMOS6502 | WDC65C02 | HuC6280, 0x99, 3, 5, Absolute | Y_Indexed },
+    { "STX", NMOS6502 | WDC65C02 | HuC6280, 0x86, 2, 4, ZeroPage },
+    { "STX", NMOS6502 | WDC65C02 | HuC6280, 0x96, 2, 4, ZeroPage | Y_Indexed },
+    { "STX", NMOS6502 | WDC65C02 | HuC6280, 0x8E, 3, 5, Absolute },
+    { "STY", NMOS6502 | WDC65C02 | HuC6280, 0x84, 2, 4, ZeroPage },
+    { "STY", NMOS6502 | WDC65C02 | HuC6280, 0x94, 2, 4, ZeroPage | X_Indexed },
+    { "STY", NMOS6502 | WDC65C02 | HuC6280, 0x8C, 3, 5, Absolute },
+    { "TSX", NMOS6502 | WDC65C02 | HuC6280, 0xBA, 1, 2, Implied },
+    { "TXS", NMOS6502 | WDC65C02 | HuC6280, 0x9A, 1, 2, Implied },
+    { "TXA", NMOS6502 | WDC65C02 | HuC6280, 0x8A, 1, 2, Implied },
+    { "TAX", NMOS6502 | WDC65C02 | HuC6280, 0xAA, 1, 2, Implied },
+    { "TYA", NMOS6502 | WDC65C02 | HuC6280, 0x98, 1, 2, Implied },
+    { "TAY", NMOS6502 | WDC65C02 | HuC6280, 0xA8, 1, 2, Implied },
+    { "TAM", HuC6280, 0x53, 2, 5, Immediate },
+    { "TMA", HuC6280, 0x43, 2, 4, Immediate },
+    { "CLA", HuC6280, 0x62, 1, 2, Implied },
+    { "CLX", HuC6280, 0x82, 1, 2, Implied },
+    { "CLY", HuC6280, 0xC2, 1, 2, Implied },
+    { "STZ", WDC65C02 | HuC6280, 0x64, 2, 4, ZeroPage },
+    { "STZ", WDC65C02 | HuC6280, 0x74, 2, 4, ZeroPage | X_Indexed },
+    { "STZ", WDC65C02 | HuC6280, 0x9C, 3, 5, Absolute },
+    { "STZ", WDC65C02 | HuC6280, 0x9E, 3, 5, Absolute | X_Indexed },
+    // Register Exchange Operations
+    { "SXY", HuC6280, 0x02, 1, 3, Implied },
+    { "SAX", HuC6280, 0x22, 1, 3, Implied },
+    { "SAY", HuC6280, 0x42, 1, 3, Implied },
+    // Mass Data Transfer Operations
+    { "TAI", HuC6280, 0xF3, 7, 17, Block },
+    { "TIA", HuC6280, 0xE3, 7, 17, Block },
+    { "TDD", HuC6280, 0xC3, 7, 17, Block },
+    { "TIN", HuC6280, 0xD3, 7, 17, Block },
+    { "TII", HuC6280, 0x73, 7, 17, Block },
+    // Status Flag Operations
+    { "SED", NMOS6502 | WDC65C02 | HuC6280, 0xF8, 1, 2, Implied },
+    { "CLD", NMOS6502 | WDC65C02 | HuC6280, 0xD8, 1, 2, Implied },
+    { "SEC", NMOS6502 | WDC65C02 | HuC6280, 0x38, 1, 2, Implied },
+    { "CLC", NMOS6502 | WDC65C02 | HuC6280, 0x18, 1, 2, Implied },
+    { "SEI", NMOS6502 | WDC65C02 | HuC6280, 0x78, 1, 2, Implied },
+    { "CLI", NMOS6502 | WDC65C02 | HuC6280, 0x58, 1, 2, Implied },
+    { "SET", HuC6280, 0xF4, 1, 2, Implied },
+    { "CLV", NMOS6502 | WDC65C02 | HuC6280, 0xB8, 1, 2, Implied },
+    // Bit Operations
+    { "SMB0", WDC65C02 | HuC6280, 0x87, 2, 7, ZeroPage },
+    { "SMB1", WDC65C02 | HuC6280, 0x97, 2, 7, ZeroPage },
+    { "SMB2", WDC65C02 | HuC6280, 0xA7, 2, 7, ZeroPage },
+    { "SMB3", WDC65C02 | HuC6280, 0xB7, 2, 7, ZeroPage },
+    { "SMB4", WDC65C02 | HuC6280, 0xC7, 2, 7, ZeroPage },
+    { "SMB5", WDC65C02 | HuC6280, 0xD7, 2, 7, ZeroPage },
+    { "SMB6", WDC65C02 | HuC6280, 0xE7, 2, 7, ZeroPage },
+    { "SMB7", WDC65C02 | HuC6280, 0xF7, 2, 7, ZeroPage },
+    { "RMB0", WDC65C02 | HuC6280, 0x07, 2, 7, ZeroPage },
+    { "RMB1", WDC65C02 | HuC6280, 0x17, 2, 7, ZeroPage },
+    { "RMB2", WDC65C02 | HuC6280, 0x27, 2, 7, ZeroPage },
+    { "RMB3", WDC65C02 | HuC6280, 0x37, 2, 7, ZeroPage },
+    { "RMB4", WDC65C02 | HuC6280, 0x47, 2, 7, ZeroPage },
+    { "RMB5", WDC65C02 | HuC6280, 0x57, 2, 7, ZeroPage },
+    { "RMB6", WDC65C02 | HuC6280, 0x67, 2, 7, ZeroPage },
+    { "RMB7", WDC65C02 | HuC6280, 0x77, 2, 7, ZeroPage },
+    // Stack Operations
+    { "PHA", NMOS6502 | WDC65C02 | HuC6280, 0x48, 1, 3, Implied },
+    { "PHP", NMOS6502 | WDC65C02 | HuC6280, 0x08, 1, 3, Implied },
+    { "PHX", WDC65C02 | HuC6280, 0xDA, 1, 3, Implied },
+    { "PHY", WDC65C02 | HuC6280, 0x5A, 1, 3, Implied },
+    { "PLA", NMOS6502 | WDC65C02 | HuC6280, 0x68, 1, 4, Implied },
+    { "PLP", NMOS6502 | WDC65C02 | HuC6280, 0x28, 1, 4, Implied },
+    { "PLX", WDC65C02 | HuC6280, 0xFA, 1, 4, Implied },
+    { "PLY", WDC65C02 | HuC6280, 0x7A, 1, 4, Implied },
+    // ALU Operations
+    { "ADC", NMOS6502 | WDC65C02 | HuC6280, 0x69, 2, 2, Immediate },
+    { "ADC", NMOS6502 | WDC65C02 | HuC6280, 0x65, 2, 4, ZeroPage },
+    { "ADC", NMOS6502 | WDC65C02 | HuC6280, 0x75, 2, 4, ZeroPage | X_Indexed },
+    { "ADC", WDC65C02 | HuC6280, 0x72, 2, 7, ZeroPage | Indirect },
+    { "ADC", NMOS6502 | WDC65C02 | HuC6280, 0x61, 2, 7, ZeroPage | X_Indexed | Indirect },
+    { "ADC", NMOS6502 | WDC65C02 | HuC6280, 0x71, 2, 7, ZeroPage | Indirect | Y_Indexed },
+    { "ADC", NMOS6502 | WDC65C02 | HuC6280, 0x6D, 3, 5, Absolute },
+    { "ADC", NMOS6502 | WDC65C02 | HuC6280, 0x7D, 3, 5, Absolute | X_Indexed },
+    { "ADC", NMOS6502 | WDC65C02 | HuC6280, 0x79, 3, 5, Absolute | Y_Indexed },
+    { "SBC", NMOS6502 | WDC65C02 | HuC6280, 0xE9, 2, 2, Immediate },
+    { "SBC", NMOS6502 | WDC65C02 | HuC6280, 0xE5, 2, 4, ZeroPage },
+    { "SBC", NMOS6502 | WDC65C02 | HuC6280, 0xF5, 2, 4, ZeroPage | X_Indexed },
+    { "SBC", WDC65C02 | HuC6280, 0xF2, 2, 7, ZeroPage | Indirect },
+    { "SBC", NMOS6502 | WDC65C02 | HuC6280, 0xE1, 2, 7, ZeroPage | X_Indexed | Indirect },
+    { "SBC", NMOS6502 | WDC65C02 | HuC6280, 0xF1, 2, 7, ZeroPage | Indirect | Y_Indexed },
+    { "SBC", NMOS6502 | WDC65C02 | HuC6280, 0xED, 3, 5, Absolute },
+    { "SBC", NMOS6502 | WDC65C02 | HuC6280, 0xFD, 3, 5, Absolute | X_Indexed },
+    { "SBC", NMOS6502 | WDC65C02 | HuC6280, 0xF9, 3, 5, Absolute | Y_Indexed },
+    { "AND", NMOS6502 | WDC65C02 | HuC6280, 0x29, 2, 2, Immediate },
+    { "AND", NMOS6502 | WDC65C02 | HuC6280, 0x25, 2, 4, ZeroPage },
+    { "AND", NMOS6502 | WDC65C02 | HuC6280, 0x35, 2, 4, ZeroPage | X_Indexed },
+    { "AND", WDC65C02 | HuC6280, 0x32, 2, 7, ZeroPage | Indirect },
+    { "AND", NMOS6502 | WDC65C02 | HuC6280, 0x21, 2, 7, ZeroPage | X_Indexed | Indirect },
+    { "AND", NMOS6502 | WDC65C02 | HuC6280, 0x31, 2, 7, ZeroPage | Indirect | Y_Indexed },
+    { "AND", NMOS6502 | WDC65C02 | HuC6280, 0x2D, 3, 5, Absolute },
+    { "AND", NMOS6502 | WDC65C02 | HuC6280, 0x3D, 3, 5, Absolute | X_Indexed },
+    { "AND", NMOS6502 | WDC65C02 | HuC6280, 0x39, 3, 5, Absolute | Y_Indexed },
+    { "ORA", NMOS6502 | WDC65C02 | HuC6280, 0x09, 2, 2, Immediate },
+    { "ORA", NMOS6502 | WDC65C02 | HuC6280, 0x05, 2, 4, ZeroPage },
+    { "ORA", NMOS6502 | WDC65C02 | HuC6280, 0x15, 2, 4, ZeroPage | X_Indexed },
+    { "ORA", WDC65C02 | HuC6280, 0x12, 2, 7, ZeroPage | Indirect },
+    { "ORA", NMOS6502 | WDC65C02 | HuC6280, 0x01, 2, 7, ZeroPage | X_Indexed | Indirect },
+    { "ORA", NMOS6502 | WDC65C02 | HuC6280, 0x11, 2, 7, ZeroPage | Indirect | Y_Indexed },
+    { "ORA", NMOS6502 | WDC65C02 | HuC6280, 0x0D, 3, 5, Absolute },
+    { "ORA", NMOS6502 | WDC65C02 | HuC6280, 0x1D, 3, 5, Absolute | X_Indexed },
+    { "ORA", NMOS6502 | WDC65C02 | HuC6280, 0x19, 3, 5, Absolute | Y_Indexed },
+    { "EOR", NMOS6502 | WDC65C02 | HuC6280, 0x49, 2, 2, Immediate },
+    { "EOR", NMOS6502 | WDC65C02 | HuC6280, 0x45, 2, 4, ZeroPage },
+    { "EOR", NMOS6502 | WDC65C02 | HuC6280, 0x55, 2, 4, ZeroPage | X_Indexed },
+    { "EOR", WDC65C02 | HuC6280, 0x52, 2, 7, ZeroPage | Indirect },
+    { "EOR", NMOS6502 | WDC65C02 | HuC6280, 0x41, 2, 7, ZeroPage | X_Indexed | Indirect },
+    { "EOR", NMOS6502 | WDC65C02 | HuC6280, 0x51, 2, 7, ZeroPage | Indirect | Y_Indexed },
+    { "EOR", NMOS6502 | WDC65C02 | HuC6280, 0x4D, 3, 5, Absolute },
+    { "EOR", NMOS6502 | WDC65C02 | HuC6280, 0x5D, 3, 5, Absolute | X_Indexed },
+    { "EOR", NMOS6502 | WDC65C02 | HuC6280, 0x59, 3, 5, Absolute | Y_Indexed },
+    // Bitwise Shift Operations
+    { "ASL", NMOS6502 | WDC65C02 | HuC6280, 0x06, 2, 6, ZeroPage },
+    { "ASL", NMOS6502 | WDC65C02 | HuC6280, 0x16, 2, 6, ZeroPage | X_Indexed },
+    { "ASL", NMOS6502 | WDC65C02 | HuC6280, 0x0E, 3, 7, Absolute },
+    { "ASL", NMOS6502 | WDC65C02 | HuC6280, 0x1E, 3, 7, Absolute | X_Indexed },
+    { "ASL", NMOS6502 | WDC65C02 | HuC6280, 0x0A, 1, 2, Accumulator },
+    { "ROL", NMOS6502 | WDC65C02 | HuC6280, 0x26, 2, 6, ZeroPage },
+    { "ROL", NMOS6502 | WDC65C02 | HuC6280, 0x36, 2, 6, ZeroPage | X_Indexed },
+    { "ROL", NMOS6502 | WDC65C02 | HuC6280, 0x2E, 3, 7, Absolute },
+    { "ROL", NMOS6502 | WDC65C02 | HuC6280, 0x3E, 3, 7, Absolute | X_Indexed },
+    { "ROL", NMOS6502 | WDC65C02 | HuC6280, 0x2A, 1, 2, Accumulator },
+    { "LSR", NMOS6502 | WDC65C02 | HuC6280, 0x46, 2, 6, ZeroPage },
+    { "LSR", NMOS6502 | WDC65C02 | HuC6280, 0x56, 2, 6, ZeroPage | X_Indexed },
+    { "LSR", NMOS6502 | WDC65C02 | HuC6280, 0x4E, 3, 7, Absolute },
+    { "LSR", NMOS6502 | WDC65C02 | HuC6280, 0x5E, 3, 7, Absolute | X_Indexed },
+    { "LSR", NMOS6502 | WDC65C02 | HuC6280, 0x4A, 1, 2, Accumulator },
+    { "ROR", NMOS6502 | WDC65C02 | HuC6280, 0x66, 2, 6, ZeroPage },
+    { "ROR", NMOS6502 | WDC65C02 | HuC6280, 0x76, 2, 6, ZeroPage | X_Indexed },
+    { "ROR", NMOS6502 | WDC65C02 | HuC6280, 0x6E, 3, 7, Absolute },
+    { "ROR", NMOS6502 | WDC65C02 | HuC6280, 0x7E, 3, 7, Absolute | X_Indexed },
+    { "ROR", NMOS6502 | WDC65C02 | HuC6280, 0x6A, 1, 2, Accumulator },
+    // Increment/Decrement Operations
+    { "DEC", NMOS6502 | WDC65C02 | HuC6280, 0xC6, 2, 6, ZeroPage },
+    { "DEC", NMOS6502 | WDC65C02 | HuC6280, 0xD6, 2, 6, ZeroPage | X_Indexed },
+    { "DEC", NMOS6502 | WDC65C02 | HuC6280, 0xCE, 3, 7, Absolute },
+    { "DEC", NMOS6502 | WDC65C02 | HuC6280, 0xDE, 3, 7, Absolute | X_Indexed },
+    { "DEC", WDC65C02 | HuC6280, 0x3A, 1, 2, Accumulator },
+    { "DEX", NMOS6502 | WDC65C02 | HuC6280, 0xCA, 1, 2, Implied },
+    { "DEY", NMOS6502 | WDC65C02 | HuC6280, 0x88, 1, 2, Implied },
+    { "INC", NMOS6502 | WDC65C02 | HuC6280, 0xE6, 2, 6, ZeroPage },
+    { "INC", NMOS6502 | WDC65C02 | HuC6280, 0xF6, 2, 6, ZeroPage | X_Indexed },
+    { "INC", NMOS6502 | WDC65C02 | HuC6280, 0xEE, 3, 7, Absolute },
+    { "INC", NMOS6502 | WDC65C02 | HuC6280, 0xFE, 3, 7, Absolute | X_Indexed },
+    { "INC", WDC65C02 | HuC6280, 0x1A, 1, 2, Accumulator },
+    { "INX", NMOS6502 | WDC65C02 | HuC6280, 0xE8, 1, 2, Implied },
+    { "INY", NMOS6502 | WDC65C02 | HuC6280, 0xC8, 1, 2, Implied },
+    // Comparison Operations
+    { "CMP", NMOS6502 | WDC65C02 | HuC6280, 0xC9, 2, 2, Immediate },
+    { "CMP", NMOS6502 | WDC65C02 | HuC6280, 0xC5, 2, 4, ZeroPage },
+    { "CMP", NMOS6502 | WDC65C02 | HuC6280, 0xD5, 2, 4, ZeroPage | X_Indexed },
+    { "CMP", WDC65C02 | HuC6280, 0xD2, 2, 7, ZeroPage | Indirect },
+    { "CMP", NMOS6502 | WDC65C02 | HuC6280, 0xC1, 2, 7, ZeroPage | X_Indexed | Indirect },
+    { "CMP", NMOS6502 | WDC65C02 | HuC6280, 0xD1, 2, 7, ZeroPage | Indirect | Y_Indexed },
+    { "CMP", NMOS6502 | WDC65C02 | HuC6280, 0xCD, 3, 5, Absolute },
+    { "CMP", NMOS6502 | WDC65C02 | HuC6280, 0xDD, 3, 5, Absolute | X_Indexed },
+    { "CMP", NMOS6502 | WDC65C02 | HuC6280, 0xD9, 3, 5, Absolute | Y_Indexed },
+    { "CPX", NMOS6502 | WDC65C02 | HuC6280, 0xE0, 2, 2, Immediate },
+    { "CPX", NMOS6502 | WDC65C02 | HuC6280, 0xE4, 2, 4, ZeroPage },
+    { "CPX", NMOS6502 | WDC65C02 | HuC6280, 0xEC, 3, 5, Absolute },
+    { "CPY", NMOS6502 | WDC65C02 | HuC6280, 0xC0, 2, 2, Immediate },
+    { "CPY", NMOS6502 | WDC65C02 | HuC6280, 0xC4, 2, 4, ZeroPage },
+    { "CPY", NMOS6502 | WDC65C02 | HuC6280, 0xCC, 3, 5, Absolute },
+    // Bit Testing Operations
+    { "BIT", WDC65C02 | HuC6280, 0x89, 2, 2, Immediate },
+    { "BIT", NMOS6502 | WDC65C02 | HuC6280, 0x24, 2, 4, ZeroPage },
+    { "BIT", WDC65C02 | HuC6280, 0x34, 2, 4, ZeroPage | X_Indexed },
+    { "BIT", NMOS6502 | WDC65C02 | HuC6280, 0x2C, 3, 5, Absolute },
+    { "BIT", WDC65C02 | HuC6280, 0x3C, 3, 5, Absolute | X_Indexed },
+    { "TRB", WDC65C02 | HuC6280, 0x14, 2, 6, ZeroPage },
+    { "TRB", WDC65C02 | HuC6280, 0x1C, 3, 7, Absolute },
+    { "TSB", WDC65C02 | HuC6280, 0x04, 2, 6, ZeroPage },
+    { "TSB", WDC65C02 | HuC6280, 0x0C, 3, 7, Absolute },
+    { "TST", HuC6280, 0x83, 3, 7, Immediate | Secondary | ZeroPage },
+    { "TST", HuC6280, 0xA3, 3, 7, Immediate | Secondary | ZeroPage | X_Indexed },
+    { "TST", HuC6280, 0x93, 4, 8, Immediate | Secondary | Absolute },
+    { "TST", HuC6280, 0xB3, 4, 8, Immediate | Secondary | Absolute | X_Indexed },
+    // Miscellaneous Operations
+    { "NOP", NMOS6502 | WDC65C02 | HuC6280, 0xEA, 1, 2, Implied },
+    { "CSH", HuC6280, 0xD4, 1, 3, Implied },
+    { "CSL", HuC6280, 0x54, 1, 3, Implied },
+  }
+};
+
+// 16 bytes so four entries share a cache line and a full table is 4KB
+struct alignas(16) opcode_entry
+{
+  std::array<char, 4> mnemonic_chars;  // NUL padded
+  modes_t mode_data;
+  isa cpus;
+  uint8_t byte_count;                  // zero for unassigned opcodes
+  cycle_cost cost;
+
+  constexpr bool valid(void) const { return byte_count; }
+
+  constexpr std::string_view mnemonic(void) const
+  {
+    std::size_t length = 0;
+    while(length < mnemonic_chars.size() && mnemonic_chars[length])
+      ++length;
+    return std::string_view(mnemonic_chars.data(), length);
+  }
+};
+
+static_assert(sizeof(opcode_entry) == 16);
+
+// opcode_rows index of each opcode by isa bit, since an opcode may be a different row on each cpu
+inline constexpr uint8_t no_opcode_row = 0xFF;
+
+using opcode_row_index_t = std::array<std::array<uint8_t, 256>, isa_count>;
+
+constexpr opcode_row_index_t build_opcode_row_index(void)
+{
+  opcode_row_index_t index = {};
+  for(auto& rows : index)
+    rows.fill(no_opcode_row);
+  for(std::size_t pos = 0; pos < opcode_rows.size(); ++pos)
+    for(int bit = 0; bit < isa_count; ++bit)
+      if(opcode_rows[pos].cpus & (1 << bit))
+        index[bit][opcode_rows[pos].opcode] = uint8_t(pos);
+  return index;
+}
+
+inline constexpr opcode_row_index_t opcode_row_index = build_opcode_row_index();
+
+// exact cycles for the decoded instruction at data, which must hold the whole instruction
+constexpr uint32_t instruction_cycles(const opcode_entry& entry, const uint8_t* data, bool branch_taken)
+  { return entry.cost.cycles(branch_taken, entry.cost.per_byte ? block_length(data) : 0); }
+
+using opcode_table_t = std::array<opcode_entry, 256>;
+
+constexpr opcode_table_t build_opcode_table(isa target)
+{
+  opcode_table_t table = {};
+  for(const opcode_row& row : opcode_rows)
+  {
+    if(row.cpus & target)
+    {
+      opcode_entry& entry = table[row.opcode];
+      for(std::size_t pos = 0; pos < row.mnemonic.size() && pos < entry.mnemonic_chars.size(); ++pos)
+        entry.mnemonic_chars[pos] = row.mnemonic[pos];
+      entry.mode_data = row.mode_data;
+      entry.cpus = row.cpus;
+      entry.byte_count = row.byte_count;
+      entry.cost = row.cost();
+    }
+  }
+  return table;
+}
+
+constexpr bool opcodes_are_unique(isa target)
+{
+  std::array<int, 256> claims = {};
+  for(const opcode_row& row : opcode_rows)
+    if(row.cpus & target && ++claims[row.opcode] > 1)
+      return false;
+  return true;
+}
+
+constexpr bool mnemonics_fit(void)
+{
+  for(const opcode_row& row : opcode_rows)
+    if(row.mnemonic.empty() || row.mnemonic.size() > sizeof(opcode_entry::mnemonic_chars) || !row.byte_count)
+      return false;
+  return true;
+}
+
+// what a modes_t chain implies, walked nibble by nibble from the top like modes_decoder()
+struct mode_timing
+{
+  uint8_t byte_count;
+  uint8_t cycles;       // base cycles of an instruction that only reads its operand
+  bool fixed_cycles;    // Indirect and Accumulator forms take the same time whatever the instruction
+};
+
+constexpr mode_timing evaluate_modes(modes_t mode_data)
+{
+  uint8_t byte_count = 1;
+  uint8_t earlier = 0;  // cycles of the operand before Secondary
+  uint8_t cycles = 2;
+  bool fixed_cycles = false;
+  for(int shift = 28; shift >= 0; shift -= 4)
+  {
+    switch((uint32_t(mode_data) >> shift) & 0xF)
+    {
+      case ZeroPage:    byte_count += 1; cycles = 4; break;
+      case Absolute:    byte_count += 2; cycles = 5; break;
+      case Immediate:   byte_count += 1; break;
+      case Relative:    byte_count += 1; break;
+      case Block:       byte_count += 6; cycles = 17; break;
+      case Indirect:    cycles = 7; fixed_cycles = true; break;
+      case Accumulator: fixed_cycles = true; break;
+      case Secondary:
+        earlier += cycles;
+        cycles = 2;
+        break;
+    }
+  }
+  return { byte_count, uint8_t(earlier + cycles), fixed_cycles };
+}
+
+// cycles a mnemonic takes beyond evaluate_modes() in every form that is not fixed_cycles
+struct cycle_adjustment
+{
+  std::string_view mnemonic;  // "SMB#" covers SMB0 to SMB7
+  int8_t extra;
+};
+
+static constexpr std::array<cycle_adjustment, 36> cycle_adjustments =
+{
+  {
+    // read-modify-write
+    { "ASL", 2 }, { "ROL", 2 }, { "LSR", 2 }, { "ROR", 2 }, { "DEC", 2 }, { "INC", 2 },
+    { "TRB", 2 }, { "TSB", 2 }, { "SMB#", 3 }, { "RMB#", 3 }, { "TST", 1 },
+    // control flow
+    { "JMP", -1 }, { "JSR", 2 }, { "BSR", 6 }, { "BRA", 2 }, { "RTS", 5 }, { "RTI", 5 }, { "BRK", 6 },
+    // stack
+    { "PHA", 1 }, { "PHP", 1 }, { "PHX", 1 }, { "PHY", 1 },
+    { "PLA", 2 }, { "PLP", 2 }, { "PLX", 2 }, { "PLY", 2 },
+    // HuC6280
+    { "SXY", 1 }, { "SAX", 1 }, { "SAY", 1 }, { "CSH", 1 }, { "CSL", 1 },
+    { "TAM", 3 }, { "TMA", 2 }, { "ST0", 3 }, { "ST1", 3 }, { "ST2", 3 },
+  }
+};
+
+constexpr int8_t cycle_adjustment_of(std::string_view mnemonic)
+{
+  for(const cycle_adjustment& entry : cycle_adjustments)
+    if(entry.mnemonic == mnemonic ||
+       (entry.mnemonic.ends_with('#') && mnemonic.size() == entry.mnemonic.size() &&
+        mnemonic.starts_with(entry.mnemonic.substr(0, entry.mnemonic.size() - 1))))
+      return entry.extra;
+  return 0;
+}
+
+// the base cycles of a row as its mnemonic and addressing modes determine them
+constexpr uint8_t expected_cycles(const opcode_row& row)
+{
+  mode_timing timing = evaluate_modes(row.mode_data);
+  return uint8_t(timing.cycles + (timing.fixed_cycles ? 0 : cycle_adjustment_of(row.mnemonic)));
+}
+
+// index of the first row whose counts disagree with its mode chain, or the row count
+constexpr std::size_t first_bad_byte_count(void)
+{
+  for(std::size_t pos = 0; pos < opcode_rows.size(); ++pos)
+    if(evaluate_modes(opcode_rows[pos].mode_data).byte_count != opcode_rows[pos].byte_count)
+      return pos;
+  return opcode_rows.size();
+}
+
+constexpr std::size_t first_bad_cycle_count(void)
+{
+  for(std::size_t pos = 0; pos < opcode_rows.size(); ++pos)
+    if(opcode_rows[pos].cycle_count != expected_cycles(opcode_rows[pos]))
+      return pos;
+  return opcode_rows.size();
+}
+
+static_assert(first_bad_byte_count() == opcode_rows.size(), "opcode_rows has a byte count that does not match its addressing modes");
+static_assert(first_bad_cycle_count() == opcode_rows.size(), "opcode_rows has a cycle count that does not match its mnemonic and addressing modes");
+static_assert(opcodes_are_unique(NMOS6502), "an NMOS6502 opcode is assigned more than once");
+static_assert(opcodes_are_unique(WDC65C02), "a WDC65C02 opcode is assigned more than once");
+static_assert(opcodes_are_unique(HuC6280), "a HuC6280 opcode is assigned more than once");
+static_assert(opcode_rows.size() < no_opcode_row);
+static_assert(mnemonics_fit(), "opcode_rows contains a row that does not fit in an opcode_entry");
+
+inline constexpr opcode_table_t nmos6502_opcodes = build_opcode_table(NMOS6502);
+inline constexpr opcode_table_t wdc65c02_opcodes = build_opcode_table(WDC65C02);
+inline constexpr opcode_table_t huc6280_opcodes = build_opcode_table(HuC6280);
+
+constexpr const opcode_table_t& opcode_table(isa target)
+{
+  switch(target)
+  {
+    case NMOS6502: return nmos6502_opcodes;
+    case WDC65C02: return wdc65c02_opcodes;
+    default:       return huc6280_opcodes;
+  }
+}
+
+#endif // OPCODE_TABLE_H
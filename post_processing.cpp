@@ -1,12 +1,20 @@
 #include "post_processing.h"
 
 #include "build_instructions.h"
+#include "opcode_table.h"
+#include "string_pool.h"
+#include "row_cache.h"
+#include "profiler.h"
 
 #include <cassert>
 #include <format>
 #include <optional>
 #include <variant>
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <regex>
 #include <array>
 #include <iostream>
@@ -18,39 +26,119 @@ using namespace std::literals;
 using namespace std::string_view_literals;
 using namespace std::literals::string_literals;
 
-void modes_decoder(mnemonic op_mnemonic, mode_details& details)
+void replace_patterns(std::string& data, const pattern_table& patterns)
 {
-  details.abstract_string = std::regex_replace(details.abstract_string,
-                                           std::regex("IMM", std::regex_constants::extended),
-                                           "$nn", std::regex_constants::format_sed);
+  static profiler::phase& phase = profiler::register_phase("replace_patterns");
+  profiler::scoped_timer timer(phase);
 
-  details.abstract_string = std::regex_replace(details.abstract_string,
-                                           std::regex("REL", std::regex_constants::extended),
-                                           "$rr", std::regex_constants::format_sed);
-  if(details.mnemonic_fill_value)
+  try
+  {
+    if(!data.empty())
+      for(const auto& spair : patterns)
+        data = std::regex_replace(data,
+                                  spair.first,
+                                  spair.second,
+                                  std::regex_constants::format_sed);
+  }
+  catch(const std::regex_error& err)
   {
-    uint8_t value = details.mnemonic_fill_value.value();
+    std::cerr << err.what() << std::endl;
+  }
+}
 
-    details.abstract_string = std::regex_replace(details.abstract_string,
-                                             std::regex("#n", std::regex_constants::extended),
-                                             std::to_string(value), std::regex_constants::format_sed);
+// A literal token and its replacement, which may not be longer than the token
+struct token_substitution
+{
+  std::string_view token;
+  std::string_view replacement;
+};
+
+template<std::size_t N>
+constexpr bool never_lengthens(const std::array<token_substitution, N>& table)
+{
+  for(const auto& entry : table)
+    if(entry.token.empty() || entry.replacement.size() > entry.token.size())
+      return false;
+  return true;
+}
+
+// Replaces each token in one left to right pass that compacts the string in place, trying
+// the tokens in table order at each position.  This matches running the substitutions over
+// the whole string one after another as long as no replacement can form another token.
+template<std::size_t N>
+void substitute_tokens(std::string& data, const std::array<token_substitution, N>& table)
+{
+  std::size_t out = 0;
+  for(std::size_t in = 0; in < data.size(); )
+  {
+    std::string_view rest = std::string_view(data).substr(in);
+    auto match = std::find_if(std::begin(table), std::end(table),
+                              [rest](const token_substitution& entry) { return rest.starts_with(entry.token); });
+    if(match == std::end(table))
+      data[out++] = data[in++];
+    else
+    {
+      std::copy(std::begin(match->replacement), std::end(match->replacement), std::begin(data) + out);
+      out += match->replacement.size();
+      in += match->token.size();
+    }
+  }
+  data.resize(out);
+}
+
+static constexpr std::array<token_substitution, 2> operand_tokens =
+{
+  {
+    { "IMM"sv, "$nn"sv },
+    { "REL"sv, "$rr"sv },
+  }
+};
+
+static constexpr std::array<token_substitution, 1> address_mode_tokens =
+{
+  {
+    { ",  and ,"sv, " and"sv },
+  }
+};
+
+static constexpr std::array<token_substitution, 1> pceas_syntax_tokens =
+{
+  {
+    { ", )"sv, ")"sv },
+  }
+};
+
+static_assert(never_lengthens(operand_tokens) &&
+              never_lengthens(address_mode_tokens) &&
+              never_lengthens(pceas_syntax_tokens));
 
-    details.name_string = std::regex_replace(details.name_string,
-                                             std::regex("#n", std::regex_constants::extended),
-                                             std::to_string(value), std::regex_constants::format_sed);
+// text shared by the mode rows of the instruction blocks
+static string_pool shared_text;
 
+void modes_decoder(const instruction& parent, mode_details& details)
+{
+  static profiler::phase& phase = profiler::register_phase("modes_decoder");
+  profiler::scoped_timer timer(phase);
+
+  mnemonic op_mnemonic = parent.data<mnemonic>();
+  substitute_tokens(details.abstract_string, operand_tokens);
+  if(details.mnemonic_fill_value)
+  {
+    const char digit = '0' + details.mnemonic_fill_value.value();
+    const std::array<token_substitution, 1> fill_value_tokens = { { { "#n"sv, std::string_view(&digit, 1) } } };
 
-    details.name_string = std::regex_replace(details.name_string,
-                                             std::regex("#n", std::regex_constants::extended),
-                                             std::to_string(value), std::regex_constants::format_sed);
+    substitute_tokens(details.abstract_string, fill_value_tokens);
 
+    std::string fill_text = parent.data<name>();
+    substitute_tokens(fill_text, fill_value_tokens);
+    details.name_string = shared_text.intern(fill_text);
 
-    details.summary_string = std::regex_replace(details.summary_string,
-                                                std::regex("#n", std::regex_constants::extended),
-                                                std::to_string(value), std::regex_constants::format_sed);
+    fill_text = parent.data<summary>();
+    substitute_tokens(fill_text, fill_value_tokens);
+    details.summary_string = shared_text.intern(fill_text);
 
     op_mnemonic.pop_back();
-    op_mnemonic.push_back('0' + value);
+    op_mnemonic.push_back(digit);
   }
 
   uint32_t data = details.mode_data;
@@ -61,8 +149,6 @@ void modes_decoder(mnemonic op_mnemonic, mode_details& details)
   std::string first_mode;
   std::string mem_string;
   details.machine = std::format("{:02X}", details.opcode);
-  int cycle_count = 1;
-  int byte_count = 1;
 
   bool is_zero_page = false;
   bool is_absolute = false;
@@ -77,8 +163,6 @@ void modes_decoder(mnemonic op_mnemonic, mode_details& details)
       details.pceas_syntax_string += "$ZZ";
       details.machine += " ZZ";
       mem_string = "ZP8($ZZ)"; // mem string base
-      cycle_count += 3;
-      byte_count += 1;
       break;
     case Implied:
       details.address_mode_string += "Implied";
@@ -89,40 +173,30 @@ void modes_decoder(mnemonic op_mnemonic, mode_details& details)
       details.pceas_syntax_string += "$hhll";
       details.machine += " ll hh";
       mem_string = "$hhll"; // mem string base
-      cycle_count += 4;
-      byte_count += 2;
       break;
     case Immediate:
       details.address_mode_string += "Immediate";
       details.pceas_syntax_string += "#$nn";
       details.machine += " nn";
       mem_string = "$nn"; // mem string base
-      cycle_count += 1;
-      byte_count += 1;
       break;
     case Accumulator:
       details.address_mode_string += "Accumulator";
       details.pceas_syntax_string += "A";
       mem_string = "A"; // mem string base
-      cycle_count += 1;
       break;
     case Relative:
       details.address_mode_string += "Relative";
       details.pceas_syntax_string += "$rr";
       details.machine += " rr";
-      cycle_count += 1;
-      byte_count += 1;
       break;
     case Block:
       details.address_mode_string = "Block";
       details.pceas_syntax_string = "$SHSL, $DHDL, $LHLL";
       details.machine += " SL SH DH DL LL HL";
-      byte_count += 6;
-      details.cycle_count = "17 + 6 * $LHLL";
       break;
     case Indirect:
       details.address_mode_string += "Indirect";
-      cycle_count += 3;
       details.pceas_syntax_string.pop_back();
       details.pceas_syntax_string.pop_back();
       details.pceas_syntax_string = "(" + details.pceas_syntax_string + ")";
@@ -175,24 +249,9 @@ void modes_decoder(mnemonic op_mnemonic, mode_details& details)
   details.pceas_syntax_string.pop_back();
   details.pceas_syntax_string.pop_back();
 
-  details.address_mode_string = std::regex_replace(details.address_mode_string,
-                            std::regex(R"~(,  and ,)~", std::regex_constants::extended),
-                            R"~( and)~", std::regex_constants::format_sed);
-
-  details.pceas_syntax_string = std::regex_replace(details.pceas_syntax_string,
-                            std::regex(R"~(, \))~", std::regex_constants::extended),
-                            R"~())~", std::regex_constants::format_sed);
-
-  if(!details.cycle_count.index())
-    details.cycle_count = std::to_string(cycle_count);
-  if(details.cycle_count.index() == 1 &&
-     std::get<int>(details.cycle_count) != cycle_count)
-  {
-    std::cerr << "mismatch " << op_mnemonic << " : " << details.address_mode_string << std::endl
-              << "expected " << std::get<int>(details.cycle_count) << " got " << cycle_count << std::endl;
-  }
+  substitute_tokens(details.address_mode_string, address_mode_tokens);
+  substitute_tokens(details.pceas_syntax_string, pceas_syntax_tokens);
 
-  assert(details.byte_count == byte_count);
   details.pceas_syntax_string = op_mnemonic + " " + first_mode + details.pceas_syntax_string;
 }
 /*
@@ -342,46 +401,31 @@ static constexpr std::array<std::pair<const char*, const char*>, 22> short_accro
 };
 
 
-template<typename T>
-void replace_symbols(std::string& data, const T& symbols)
-{
-  if(!data.empty())
-    for(const auto& spair : symbols)
-    {
-      auto pos = std::begin(data);
-      while(pos = std::search(pos, std::end(data), std::begin(spair.first), std::end(spair.first)),
-            pos != std::end(data))
-      {
-         pos = data.erase(pos, pos + spair.first.size());
-         pos = data.insert(pos, std::begin(spair.second), std::end(spair.second));
-         pos = std::next(pos, spair.second.size());
-      }
-    }
-}
+const substitution_table typeable_substitutions = typeable_symbols;
+const substitution_table long_accronym_substitutions = long_accronyms;
 
-template<typename T>
-void replace_patterns(std::string& data, const T& patterns)
+void replace_symbols(std::string& data, const substitution_table& symbols)
 {
-  try
-  {
-    if(!data.empty())
-      for(const auto& spair : patterns)
-        data = std::regex_replace(data,
-                                  std::regex(spair.first, std::regex_constants::extended),
-                                  spair.second,
-                                  std::regex_constants::format_sed);
-  }
-  catch(const std::regex_error& err)
-  {
-    std::cerr << err.what() << std::endl;
-  }
+  static profiler::phase& phase = profiler::register_phase("replace_symbols");
+  profiler::scoped_timer timer(phase);
+
+  symbols.apply(data);
 }
 
+const pattern_table typeable_regexes = typeable_patterns;
+const pattern_table short_accronym_regexes = short_accronyms;
+
+static constexpr std::pair<const char*, const char*> emphasis = { "_([[:alnum:]]|#n)", R"~(<em>\1</em>)~" };
+
 std::string fix_name(std::string name)
 {
+  static profiler::phase& phase = profiler::register_phase("fix_name");
+  profiler::scoped_timer timer(phase);
+
+  static const std::regex emphasis_pattern(emphasis.first, std::regex_constants::extended);
   name = std::regex_replace(name,
-                            std::regex("_([[:alnum:]]|#n)", std::regex_constants::extended),
-                            R"~(<em>\1</em>)~", std::regex_constants::format_sed);
+                            emphasis_pattern,
+                            emphasis.second, std::regex_constants::format_sed);
   constexpr auto to_remove = "</em><em>"sv;
   std::size_t pos = std::string::npos;
   while(pos = name.find(to_remove), pos != std::string::npos)
@@ -391,49 +435,332 @@ std::string fix_name(std::string name)
 }
 
 
-void post_processing(std::list<instructions>& insn_blocks)
+std::string build_flags(const flags& farr)
 {
+  constexpr const char* const flag_ids = "NVTBDIZC";
+
+  std::string rval;
+  int idx = 0;
+  for(auto& val : farr)
+  {
+    switch(val.index())
+    {
+    case 0:
+      rval.push_back('-');
+      break;
+    case 1:
+      rval.push_back(std::get<int>(val) ? '1' : '0');
+      break;
+    case 2:
+      rval.push_back(flag_ids[idx]);
+    }
+    idx++;
+  }
+  return rval;
+}
+
+// the mnemonic of a mode row with the "#" of the bit families replaced by its digit
+std::string expanded_mnemonic(const instruction& parent, const mode_details& details)
+{
+  std::string op_mnemonic = parent.data<mnemonic>();
+  if(details.mnemonic_fill_value)
+    op_mnemonic.back() = '0' + details.mnemonic_fill_value.value();
+  return op_mnemonic;
+}
+
+// the text form of a cycle cost as written in build_insn_blocks()
+std::string cycle_string(const cycle_cost& cost)
+{
+  if(cost.per_byte)
+    return std::format("{} + {} * $LHLL", cost.base, cost.per_byte);
+  if(cost.branch_taken)
+    return std::format("{} ({} if branch taken)", cost.base, cost.cycles(true));
+  return std::to_string(cost.base);
+}
+
+// the mode rows take their numbers from opcode_rows by opcode, so make sure each opcode is one
+// of its instruction and that the rows are in page order, which row_index consumers rely on
+const opcode_row& verify_opcode_row(std::size_t row_index, std::string op_mnemonic, const mode_details& details)
+{
+  if(row_index >= opcode_rows.size())
+    throw "opcode_rows is missing "s + op_mnemonic;
+
+  const opcode_row& row = opcode_rows[row_index];
+  if(details.mnemonic_fill_value)
+    op_mnemonic.back() = '0' + details.mnemonic_fill_value.value();
+
+  if(row.mnemonic != op_mnemonic || row.opcode != details.opcode)
+    throw std::format("opcode_rows entry {} ({}) does not match {} ${:02X}", row_index, row.mnemonic, op_mnemonic, details.opcode);
+  return row;
+}
+
+void process_instruction_text(instruction& parent)
+{
+  parent.data<name>() = fix_name(parent.data<mnemonic_origin>());
+
+  for(auto& flag : parent.data<flags>())
+    if(flag.index() == 2)
+      replace_symbols(std::get<std::string>(flag), typeable_substitutions);
+}
+
+void process_mode_row(const instruction& parent, uint32_t parent_index, std::size_t row_index, mode_details& mdetails)
+{
+  mdetails.parent = parent_index;
+  mdetails.description_string = shared_text.intern(parent.data<description>());
+  mdetails.summary_string = shared_text.intern(parent.data<summary>());
+  mdetails.name_string = shared_text.intern(parent.data<name>());
+  if(mdetails.abstract_string.empty())
+    mdetails.abstract_string = parent.data<abstract>();
+  const opcode_row& row = verify_opcode_row(row_index, parent.data<mnemonic>(), mdetails);
+  if(!mdetails.cycle_count.index())
+    mdetails.cycle_count = cycle_string(row.cost());
+  modes_decoder(parent, mdetails);
+
+  replace_symbols(mdetails.abstract_string, typeable_substitutions);
+  replace_patterns(mdetails.abstract_string, typeable_regexes);
+  replace_symbols(mdetails.abstract_string, long_accronym_substitutions);
+  replace_patterns(mdetails.abstract_string, short_accronym_regexes);
+}
+
+// everything done to one instruction, first_row is the opcode_rows index of its first mode row
+static void process_instruction(instructions& block, uint32_t parent, std::size_t first_row)
+{
+  auto& instruction = block[parent];
+
+  std::string clean_name = instruction.data<mnemonic_origin>();
+  std::size_t underscore_count = std::count_if(std::begin(clean_name), std::end(clean_name), [](char c) -> bool { return c == '_'; });
+  if(underscore_count)
+  {
+    std::remove_if(std::begin(clean_name), std::end(clean_name), [](char c) -> bool { return c == '_'; });
+    clean_name.resize(clean_name.size() - underscore_count); // remove_if doesn't resize the container. RUDE!
+  }
+  process_instruction_text(instruction);
+
+  std::size_t row_index = first_row;
+  for(auto& mdetails : instruction.data<std::vector<mode_details>>())
+    process_mode_row(instruction, parent, row_index++, mdetails);
+
+  fix_name(instruction.data<mnemonic_origin>());
+}
+
+// Increase when the code of the passes or the layout of processed_text() changes.  Edits to
+// the substitution, pattern and token tables are picked up by pass_inputs_hash().
+static constexpr uint64_t row_cache_version = 2;
+
+// the tables the passes are driven by
+static uint64_t pass_inputs_hash(void)
+{
+  content_hash hash;
+  hash.add(row_cache_version);
+
+  auto add_pairs = [&hash](const auto& table)
+  {
+    hash.add(uint64_t(table.size()));
+    for(const auto& [from, to] : table)
+    {
+      hash.add(std::string_view(from));
+      hash.add(std::string_view(to));
+    }
+  };
+  auto add_tokens = [&hash](const auto& table)
+  {
+    hash.add(uint64_t(table.size()));
+    for(const token_substitution& entry : table)
+    {
+      hash.add(entry.token);
+      hash.add(entry.replacement);
+    }
+  };
+
+  add_pairs(typeable_symbols);
+  add_pairs(typeable_patterns);
+  add_pairs(long_accronyms);
+  add_pairs(short_accronyms);
+  add_pairs(std::array { emphasis });
+  add_tokens(operand_tokens);
+  add_tokens(address_mode_tokens);
+  add_tokens(pceas_syntax_tokens);
+  return hash.value();
+}
+
+// everything process_instruction() reads from an instruction
+static uint64_t source_hash(const instruction& source)
+{
+  static const uint64_t inputs = pass_inputs_hash();
+
+  content_hash hash;
+  hash.add(inputs);
+  hash.add(source.data<name>());
+  hash.add(source.data<mnemonic>());
+  hash.add(source.data<mnemonic_origin>());
+  hash.add(source.data<description>());
+  hash.add(source.data<summary>());
+  hash.add(source.data<abstract>());
+
+  auto add_snn = [&hash](const snn_t& value)
+  {
+    hash.add(uint64_t(value.index()));
+    if(value.index() == 1)
+      hash.add(uint64_t(std::get<int>(value)));
+    else if(value.index() == 2)
+      hash.add(std::get<std::string>(value));
+  };
+
+  for(const auto& flag : source.data<flags>())
+    add_snn(flag);
+
+  for(const auto& mdetails : source.data<std::vector<mode_details>>())
+  {
+    hash.add(uint64_t(mdetails.cpus));
+    hash.add(uint64_t(mdetails.opcode));
+    hash.add(uint64_t(mdetails.byte_count));
+    add_snn(mdetails.cycle_count);
+    hash.add(uint64_t(mdetails.mode_data));
+    hash.add(uint64_t(mdetails.mnemonic_fill_value.value_or(-1)));
+    hash.add(mdetails.abstract_string);
+    hash.add(mdetails.pceas_syntax_string);
+    hash.add(mdetails.machine);
+    hash.add(mdetails.address_mode_string);
+  }
+  return hash.value();
+}
+
+// the text process_instruction() produces, in the order restore_instruction() reads it back
+static row_cache::entry processed_text(const instruction& source)
+{
+  row_cache::entry text { source.data<name>() };
+  for(const auto& flag : source.data<flags>())
+    if(flag.index() == 2)
+      text.push_back(std::get<std::string>(flag));
+
+  for(const auto& mdetails : source.data<std::vector<mode_details>>())
+    text.insert(std::end(text), { mdetails.abstract_string,
+                                  mdetails.pceas_syntax_string,
+                                  mdetails.address_mode_string,
+                                  mdetails.machine,
+                                  std::string(mdetails.name_string),
+                                  std::string(mdetails.summary_string) });
+  return text;
+}
+
+// the same result as process_instruction() from what processed_text() saved, false if the
+// saved text does not fit the instruction
+static bool restore_instruction(instructions& block, uint32_t parent, std::size_t first_row, const row_cache::entry& text)
+{
+  static profiler::phase& phase = profiler::register_phase("restore_instruction");
+  profiler::scoped_timer timer(phase);
+
+  auto& instruction = block[parent];
+  auto& rows = instruction.data<std::vector<mode_details>>();
+  auto& farr = instruction.data<flags>();
+  std::size_t flag_count = std::count_if(std::begin(farr), std::end(farr), [](const snn_t& flag) { return flag.index() == 2; });
+  if(text.size() != 1 + flag_count + rows.size() * 6)
+    return false;
+
+  auto next = std::begin(text);
+  instruction.data<name>() = *next++;
+  for(auto& flag : farr)
+    if(flag.index() == 2)
+      std::get<std::string>(flag) = *next++;
+
+  std::size_t row_index = first_row;
+  for(auto& mdetails : rows)
+  {
+    mdetails.parent = parent;
+    mdetails.description_string = shared_text.intern(instruction.data<description>());
+    const opcode_row& row = verify_opcode_row(row_index++, instruction.data<mnemonic>(), mdetails);
+    if(!mdetails.cycle_count.index())
+      mdetails.cycle_count = cycle_string(row.cost());
+
+    mdetails.abstract_string = *next++;
+    mdetails.pceas_syntax_string = *next++;
+    mdetails.address_mode_string = *next++;
+    mdetails.machine = *next++;
+    mdetails.name_string = shared_text.intern(*next++);
+    mdetails.summary_string = shared_text.intern(*next++);
+  }
+  return true;
+}
+
+void post_processing(std::vector<instructions>& insn_blocks, unsigned int jobs, row_cache* cache)
+{
+  static profiler::phase& phase = profiler::register_phase("post_processing");
+  profiler::scoped_timer timer(phase);
+
+  struct work
+  {
+    instructions* block;
+    uint32_t parent;
+    std::size_t first_row;
+    uint64_t key;
+    const row_cache::entry* cached;
+  };
+
+  // instructions only touch their own rows so they can be processed in any order, the row
+  // numbers are assigned up front so that opcode_rows is still checked in page order
+  std::vector<work> queue;
+  std::size_t row_index = 0;
   for(auto& block : insn_blocks)
   {
-    for(auto& instruction : block)
+    for(uint32_t parent = 0; parent < block.size(); ++parent)
     {
+      auto& instruction = block[parent];
+      if(instruction.data<std::vector<mode_details>>().empty())
+        instruction.data<std::vector<mode_details>>().push_back(std::move(instruction.data<mode_details>()));
 
-      std::string clean_name = instruction.data<mnemonic_origin>();
-      std::size_t underscore_count = std::count_if(std::begin(clean_name), std::end(clean_name), [](char c) -> bool { return c == '_'; });
-      if(underscore_count)
+      queue.push_back({ &block, parent, row_index, 0, nullptr });
+      if(cache)
       {
-        std::remove_if(std::begin(clean_name), std::end(clean_name), [](char c) -> bool { return c == '_'; });
-        clean_name.resize(clean_name.size() - underscore_count); // remove_if doesn't resize the container. RUDE!
+        queue.back().key = source_hash(instruction);
+        queue.back().cached = cache->find(queue.back().key);
       }
-      instruction.data<name>() = fix_name(instruction.data<mnemonic_origin>());
+      row_index += instruction.data<std::vector<mode_details>>().size();
+    }
+  }
 
+  if(row_index != opcode_rows.size())
+    throw "opcode_rows does not have an entry for each row of the instruction blocks"s;
 
-      if(instruction.data<std::list<mode_details>>().empty())
-        instruction.data<std::list<mode_details>>().push_back(instruction.data<mode_details>());
+  if(!jobs)
+    jobs = std::max(1U, std::thread::hardware_concurrency());
+  jobs = std::min<std::size_t>(jobs, queue.size());
 
-      for(auto& mdetails : instruction.data<std::list<mode_details>>())
+  std::atomic<std::size_t> next = 0;
+  std::exception_ptr failure;
+  std::mutex failure_lock;
+  auto worker = [&]()
+  {
+    for(std::size_t pos; pos = next.fetch_add(1, std::memory_order_relaxed), pos < queue.size(); )
+    {
+      try
+      {
+        const work& current = queue[pos];
+        if(!current.cached || !restore_instruction(*current.block, current.parent, current.first_row, *current.cached))
+          process_instruction(*current.block, current.parent, current.first_row);
+      }
+      catch(...)
       {
-        mdetails.description_string = instruction.data<description>();
-        mdetails.summary_string = instruction.data<summary>();
-        mdetails.name_string = instruction.data<name>();
-        if(mdetails.abstract_string.empty())
-          mdetails.abstract_string = instruction.data<abstract>();
-        modes_decoder(instruction.data<mnemonic>(), mdetails);
-
-        replace_symbols(mdetails.abstract_string, typeable_symbols);
-        replace_patterns(mdetails.abstract_string, typeable_patterns);
-        replace_symbols(mdetails.abstract_string, long_accronyms);
-        replace_patterns(mdetails.abstract_string, short_accronyms);
+        std::lock_guard<std::mutex> guard(failure_lock);
+        if(!failure)
+          failure = std::current_exception();
+        next = queue.size(); // stop handing out work
       }
+    }
+  };
 
+  std::vector<std::thread> threads;
+  for(unsigned int pos = 1; pos < jobs; ++pos)
+    threads.emplace_back(worker);
+  worker();
+  for(auto& thread : threads)
+    thread.join();
 
-      for(auto& flag : instruction.data<flags>())
-        if(flag.index() == 2)
-          replace_symbols(std::get<std::string>(flag), typeable_symbols);
+  if(failure)
+    std::rethrow_exception(failure);
 
-      fix_name(instruction.data<mnemonic_origin>());
-    }
-  }
+  if(cache)
+    for(const work& current : queue)
+      cache->insert(current.key, processed_text((*current.block)[current.parent]));
 }
 
 #if 0
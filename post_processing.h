@@ -1,10 +1,64 @@
 #ifndef POST_PROCESSING_H
 #define POST_PROCESSING_H
 
-#include <list>
+#include "build_instructions.h"
+#include "substitution_table.h"
 
-struct instructions;
+#include <array>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
 
-void post_processing(std::list<instructions>& insn_blocks);
+// regular expressions are costly to construct so each table is compiled once and shared
+struct pattern_table : std::vector<std::pair<std::regex, std::string>>
+{
+  template<std::size_t N>
+  pattern_table(const std::array<std::pair<const char*, const char*>, N>& patterns)
+    : std::vector<std::pair<std::regex, std::string>>(N)
+  {
+    for(std::size_t pos = 0; pos < N; ++pos)
+    {
+      try
+      {
+        this->operator[](pos) = { std::regex(patterns[pos].first, std::regex_constants::extended), patterns[pos].second };
+      }
+      catch(const std::regex_error& err)
+      {
+        std::cerr << err.what() << std::endl;
+      }
+    }
+  }
+};
+
+class row_cache;
+
+// instructions are spread over jobs threads, every core when jobs is 0.  With a cache,
+// instructions whose source is unchanged since it was saved are restored from it.
+void post_processing(std::vector<instructions>& insn_blocks, unsigned int jobs = 0, row_cache* cache = nullptr);
+
+// The parts of post_processing() that one mode row needs, for callers that only want a few.
+// process_instruction_text() fixes the name and flags of an instruction and must run once
+// before any of its rows.  row_index is the opcode_rows index the row is checked against.
+void process_instruction_text(instruction& parent);
+void process_mode_row(const instruction& parent, uint32_t parent_index, std::size_t row_index, mode_details& details);
+
+// status flag column text, e.g. "NV-BDIZC"
+std::string build_flags(const flags& farr);
+
+std::string expanded_mnemonic(const instruction& parent, const mode_details& details);
+
+// the passes post_processing() is built from, also used by the benchmarks
+void replace_patterns(std::string& data, const pattern_table& patterns);
+void replace_symbols(std::string& data, const substitution_table& symbols);
+std::string fix_name(std::string name);
+void modes_decoder(const instruction& parent, mode_details& details);
+
+// applied to each abstract in this order
+extern const substitution_table typeable_substitutions;
+extern const pattern_table typeable_regexes;
+extern const substitution_table long_accronym_substitutions;
+extern const pattern_table short_accronym_regexes;
 
 #endif // POST_PROCESSING_H
@@ -0,0 +1,120 @@
+#include "profiler.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <format>
+#include <mutex>
+#include <new>
+#include <string>
+
+namespace profiler
+{
+  bool enabled = false;
+
+  // operator new only touches the counters of its own thread, they are added to the totals
+  // when the thread exits
+  static std::atomic<uint64_t> allocation_counter = 0;
+  static std::atomic<uint64_t> allocation_byte_counter = 0;
+  static thread_local uint64_t thread_allocation_counter = 0;
+  static thread_local uint64_t thread_allocation_byte_counter = 0;
+
+  struct thread_totals
+  {
+    ~thread_totals(void)
+    {
+      allocation_counter.fetch_add(thread_allocation_counter, std::memory_order_relaxed);
+      allocation_byte_counter.fetch_add(thread_allocation_byte_counter, std::memory_order_relaxed);
+    }
+  };
+
+  // constructed by the first scoped_timer of each thread
+  static thread_local thread_totals exit_totals;
+
+  static std::deque<phase>& phases(void)
+  {
+    static std::deque<phase> list; // references stay valid as it grows
+    return list;
+  }
+
+  phase& register_phase(const char* name)
+  {
+    static std::mutex lock;
+    std::lock_guard<std::mutex> guard(lock);
+    for(phase& existing : phases())
+      if(!std::strcmp(existing.name, name))
+        return existing;
+    return phases().emplace_back(name);
+  }
+
+  uint64_t allocation_count(void)
+  {
+    return allocation_counter.load(std::memory_order_relaxed) + thread_allocation_counter;
+  }
+
+  uint64_t allocation_bytes(void)
+  {
+    return allocation_byte_counter.load(std::memory_order_relaxed) + thread_allocation_byte_counter;
+  }
+
+  uint64_t thread_allocation_count(void)
+  {
+    (void)&exit_totals;
+    return thread_allocation_counter;
+  }
+
+  uint64_t thread_allocation_bytes(void)
+  {
+    return thread_allocation_byte_counter;
+  }
+
+  void report(std::ostream& out)
+  {
+    std::string table = std::format("{:<24} {:>8} {:>12} {:>12} {:>14}\n", "phase", "calls", "ms", "allocations", "bytes");
+    for(const phase& current : phases())
+      if(current.calls)
+        table += std::format("{:<24} {:>8} {:>12.3f} {:>12} {:>14}\n",
+                             current.name, current.calls.load(), current.nanoseconds.load() / 1e6, current.allocations.load(), current.bytes.load());
+    table += std::format("{:<24} {:>8} {:>12} {:>12} {:>14}\n", "total", "", "", allocation_count(), allocation_bytes());
+    out << table;
+  }
+}
+
+// allocations are only counted with --profile, the phases report the difference across their scope
+void* operator new(std::size_t size)
+{
+  if(profiler::enabled)
+  {
+    ++profiler::thread_allocation_counter;
+    profiler::thread_allocation_byte_counter += size;
+  }
+  if(void* memory = std::malloc(size ? size : 1))
+    return memory;
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+  std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+  std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+  std::free(memory);
+}
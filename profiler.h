@@ -0,0 +1,75 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+// Opt-in wall time and allocation counts for the generator phases.  Phases are inclusive,
+// so a phase that calls another also counts the time and allocations of the inner one.
+// Phases may run on several threads at once, their times are then summed over the threads
+// and allocations are counted against the thread that made them.
+namespace profiler
+{
+  struct phase
+  {
+    phase(const char* name) : name(name) { }
+
+    const char* name;
+    std::atomic<uint64_t> calls = 0;
+    std::atomic<uint64_t> nanoseconds = 0;
+    std::atomic<uint64_t> allocations = 0;
+    std::atomic<uint64_t> bytes = 0;
+  };
+
+  extern bool enabled;
+
+  // phases are listed in the order they were first registered, a name is only registered once
+  phase& register_phase(const char* name);
+
+  // counted by the global operator new while enabled, over this thread and every thread that
+  // has exited
+  uint64_t allocation_count(void);
+  uint64_t allocation_bytes(void);
+
+  // the same for the calling thread
+  uint64_t thread_allocation_count(void);
+  uint64_t thread_allocation_bytes(void);
+
+  void report(std::ostream& out);
+
+  class scoped_timer
+  {
+  public:
+    scoped_timer(phase& target)
+      : current(enabled ? &target : nullptr)
+    {
+      if(current)
+      {
+        allocations = thread_allocation_count();
+        bytes = thread_allocation_bytes();
+        start = std::chrono::steady_clock::now();
+      }
+    }
+
+    ~scoped_timer(void)
+    {
+      if(current)
+      {
+        current->nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        current->allocations += thread_allocation_count() - allocations;
+        current->bytes += thread_allocation_bytes() - bytes;
+        ++current->calls;
+      }
+    }
+
+  private:
+    phase* current;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    std::chrono::steady_clock::time_point start;
+  };
+}
+
+#endif // PROFILER_H
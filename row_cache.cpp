@@ -0,0 +1,95 @@
+#include "row_cache.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+static constexpr std::string_view magic = "HuCRowC1"sv;
+
+row_cache::row_cache(std::string filename)
+  : filename(std::move(filename))
+{
+  std::ifstream fileIn(this->filename, std::ios::binary);
+  std::string data((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+  std::string_view input = data;
+
+  auto read = [&input](uint64_t& value, std::size_t size) -> bool
+  {
+    if(input.size() < size)
+      return false;
+    value = 0;
+    for(std::size_t pos = 0; pos < size; ++pos)
+      value |= uint64_t(uint8_t(input[pos])) << (pos * 8);
+    input.remove_prefix(size);
+    return true;
+  };
+
+  uint64_t count;
+  if(!input.starts_with(magic))
+    return;
+  input.remove_prefix(magic.size());
+  if(!read(count, 4))
+    return;
+
+  std::unordered_map<uint64_t, entry> entries;
+  for(; count; --count)
+  {
+    uint64_t key, strings, length;
+    if(!read(key, 8) || !read(strings, 4))
+      return;
+    entry& value = entries[key];
+    for(; strings; --strings)
+    {
+      if(!read(length, 4) || input.size() < length)
+        return; // truncated, start over rather than use part of it
+      value.emplace_back(input.substr(0, length));
+      input.remove_prefix(length);
+    }
+  }
+  loaded.swap(entries);
+}
+
+const row_cache::entry* row_cache::find(uint64_t key) const
+{
+  auto found = loaded.find(key);
+  return found == std::end(loaded) ? nullptr : &found->second;
+}
+
+void row_cache::insert(uint64_t key, entry value)
+{
+  current.insert_or_assign(key, std::move(value));
+}
+
+// written beside the old file and renamed over it, so an interrupted run leaves the old one
+void row_cache::save(void) const
+{
+  std::string output(magic);
+  auto write = [&output](uint64_t value, std::size_t size)
+  {
+    for(std::size_t pos = 0; pos < size; ++pos)
+      output.push_back(char(value >> (pos * 8)));
+  };
+
+  write(current.size(), 4);
+  for(const auto& [key, value] : current)
+  {
+    write(key, 8);
+    write(value.size(), 4);
+    for(const std::string& text : value)
+    {
+      write(text.size(), 4);
+      output.append(text);
+    }
+  }
+
+  std::string temporary = filename + ".tmp"s;
+  {
+    std::ofstream fileOut(temporary, std::ios::binary);
+    if(!fileOut.write(output.data(), output.size()))
+      throw "unable to write: "s + temporary;
+  }
+  if(std::rename(temporary.c_str(), filename.c_str()))
+    throw "unable to replace: "s + filename;
+}
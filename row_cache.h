@@ -0,0 +1,68 @@
+#ifndef ROW_CACHE_H
+#define ROW_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// 64-bit FNV-1a, each field is length prefixed so that neighbouring fields can't run together
+class content_hash
+{
+public:
+  void add(std::string_view text)
+  {
+    add(uint64_t(text.size()));
+    for(char c : text)
+      mix(uint8_t(c));
+  }
+
+  void add(uint64_t number)
+  {
+    for(int shift = 0; shift < 64; shift += 8)
+      mix(uint8_t(number >> shift));
+  }
+
+  uint64_t value(void) const { return state; }
+
+private:
+  void mix(uint8_t byte)
+  {
+    state ^= byte;
+    state *= 0x100000001B3ULL;
+  }
+
+  uint64_t state = 0xCBF29CE484222325ULL;
+};
+
+// The post-processed text of each instruction kept between runs, keyed by a hash of its
+// source fields.  Only the entries inserted during a run are saved, so entries for
+// instructions that changed or were removed are dropped.
+//
+//   char[8]                "HuCRowC1"
+//   uint32_t               entry count
+//   entry[count]           uint64_t key, uint32_t string count, then each string as
+//                          uint32_t length and its characters
+class row_cache
+{
+public:
+  using entry = std::vector<std::string>;
+
+  // a missing or unreadable file gives an empty cache
+  row_cache(std::string filename);
+
+  // nullptr if key was not in the file
+  const entry* find(uint64_t key) const;
+
+  void insert(uint64_t key, entry value);
+
+  void save(void) const;
+
+private:
+  std::string filename;
+  std::unordered_map<uint64_t, entry> loaded;
+  std::unordered_map<uint64_t, entry> current;
+};
+
+#endif // ROW_CACHE_H
@@ -0,0 +1,31 @@
+#include "string_pool.h"
+
+#include <cstring>
+
+std::string_view string_pool::intern(std::string_view text)
+{
+  std::lock_guard<std::mutex> guard(lock);
+  auto found = index.find(text);
+  if(found != std::end(index))
+    return *found;
+  if(text.empty())
+    return {};
+
+  char* storage;
+  if(text.size() > chunk_size / 4) // large strings get a chunk of their own
+    storage = chunks.emplace(std::end(chunks) - !chunks.empty(), new char[text.size()])->get();
+  else
+  {
+    if(chunk_used + text.size() > chunk_size)
+    {
+      chunks.emplace_back(new char[chunk_size]);
+      chunk_used = 0;
+    }
+    storage = chunks.back().get() + chunk_used;
+    chunk_used += text.size();
+  }
+
+  std::memcpy(storage, text.data(), text.size());
+  stored += text.size();
+  return *index.emplace(storage, text.size()).first;
+}
@@ -0,0 +1,32 @@
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// Keeps one copy of each distinct string.  The returned views stay valid for the life of
+// the pool because text is never moved once it has been stored.  intern() may be called from
+// several threads at once.
+class string_pool
+{
+public:
+  std::string_view intern(std::string_view text);
+
+  std::size_t size(void) const { return index.size(); }  // distinct strings
+  std::size_t bytes(void) const { return stored; }       // characters held
+
+private:
+  static constexpr std::size_t chunk_size = 64 * 1024;
+
+  std::vector<std::unique_ptr<char[]>> chunks;
+  std::size_t chunk_used = chunk_size;
+  std::size_t stored = 0;
+  std::unordered_set<std::string_view> index;
+  std::mutex lock;
+};
+
+#endif // STRING_POOL_H
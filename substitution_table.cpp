@@ -0,0 +1,114 @@
+#include "substitution_table.h"
+
+#include <algorithm>
+
+using namespace std::literals::string_literals;
+
+// true if the strings can occupy some of the same characters in a string
+static bool overlaps(std::string_view a, std::string_view b)
+{
+  for(std::ptrdiff_t shift = 1 - std::ptrdiff_t(b.size()); shift < std::ptrdiff_t(a.size()); ++shift)
+  {
+    std::size_t a_pos = shift > 0 ? shift : 0;
+    std::size_t b_pos = shift > 0 ? 0 : -shift;
+    std::size_t length = std::min(a.size() - a_pos, b.size() - b_pos);
+    if(a.substr(a_pos, length) == b.substr(b_pos, length))
+      return true;
+  }
+  return false;
+}
+
+substitution_table::substitution_table(const pair_type* pairs, std::size_t count)
+  : pair_list(pairs, pairs + count),
+    next_candidate(count, 0)
+{
+  if(count >= 0xFF)
+    throw "too many substitutions: "s + std::to_string(count);
+
+  // a pair can join the current stage if its search text cannot overlap the search text or
+  // the replacement of any earlier pair in the stage, so no search text of a stage is a
+  // prefix of another
+  std::size_t stage_begin = 0;
+  for(std::size_t pos = 0; pos < count; ++pos)
+  {
+    const pair_type& spair = pairs[pos];
+    if(spair.first.empty())
+      throw "invalid substitution length: "s + std::string(spair.first);
+
+    bool independent = !stages.empty();
+    for(std::size_t other = stage_begin; independent && other < pos; ++other)
+      if(overlaps(pairs[other].first, spair.first) || overlaps(pairs[other].second, spair.first))
+        independent = false;
+
+    if(!independent)
+    {
+      stages.emplace_back();
+      stage_begin = pos;
+    }
+
+    uint8_t* link = &stages.back().first[uint8_t(spair.first.front())];
+    while(*link)
+      link = &next_candidate[*link - 1];
+    *link = uint8_t(pos + 1);
+  }
+}
+
+uint8_t substitution_table::match_at(const stage& current, std::string_view text, std::size_t pos) const
+{
+  for(uint8_t index = current.first[uint8_t(text[pos])]; index; index = next_candidate[index - 1])
+    if(text.substr(pos).starts_with(pair_list[index - 1].first))
+      return index;
+  return 0;
+}
+
+void substitution_table::apply(std::string_view input, std::string& output) const
+{
+  output.assign(input);
+  apply(output);
+}
+
+void substitution_table::apply(std::string& text) const
+{
+  thread_local std::string scratch;
+
+  for(const stage& current : stages)
+  {
+    // skips to the next character that starts a search text of the stage
+    auto candidate = [&current, &text](std::size_t pos)
+    {
+      const char* data = text.data();
+      while(pos < text.size() && !current.first[uint8_t(data[pos])])
+        ++pos;
+      return pos;
+    };
+
+    // nothing is copied until the first match
+    std::size_t pos = 0;
+    uint8_t index = 0;
+    while((pos = candidate(pos)) < text.size() && !(index = match_at(current, text, pos)))
+      ++pos;
+    if(!index)
+      continue;
+
+    // the text between matches and the replacements go to scratch, which keeps its capacity
+    // from call to call
+    std::size_t copied = 0;
+    scratch.clear();
+    while(pos < text.size())
+    {
+      if(index)
+      {
+        const pair_type& spair = pair_list[index - 1];
+        scratch.append(text, copied, pos - copied).append(spair.second);
+        pos += spair.first.size();
+        copied = pos;
+      }
+      else
+        ++pos;
+      if((pos = candidate(pos)) < text.size())
+        index = match_at(current, text, pos);
+    }
+    scratch.append(text, copied);
+    text.assign(scratch);
+  }
+}
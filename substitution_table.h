@@ -0,0 +1,48 @@
+#ifndef SUBSTITUTION_TABLE_H
+#define SUBSTITUTION_TABLE_H
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+
+// Literal substitutions applied as though each pair was run over the whole string in order.
+// Neighbouring pairs that cannot affect each other form a stage, and at most one search text
+// of a stage can match at any position, so a stage is one left to right pass that looks each
+// character up in a table of the search texts starting with it.  A stage that matches
+// nothing leaves the text alone.  The stages run one after another rather than as a single
+// sweep because later pairs rewrite what earlier ones produced, e.g. '<' becomes "&lt;" and
+// then a <var> element.
+class substitution_table
+{
+public:
+  using pair_type = std::pair<std::string_view, std::string_view>;
+
+  template<std::size_t N>
+  substitution_table(const std::array<pair_type, N>& pairs)
+    : substitution_table(pairs.data(), pairs.size()) { }
+
+  substitution_table(const pair_type* pairs, std::size_t count);
+
+  void apply(std::string_view input, std::string& output) const;
+  void apply(std::string& text) const;
+
+  // in the order they are applied
+  const std::vector<pair_type>& pairs(void) const { return pair_list; }
+
+private:
+  struct stage
+  {
+    std::array<uint8_t, 256> first = {};    // pair_list index + 1 by first character, zero for none
+  };
+
+  // pair_list index + 1 of the first match of current at pos, zero if nothing matches
+  uint8_t match_at(const stage& current, std::string_view text, std::size_t pos) const;
+
+  std::vector<pair_type> pair_list;
+  std::vector<uint8_t> next_candidate;      // pair_list index + 1 of the next pair of the stage with the same first character
+  std::vector<stage> stages;
+};
+
+#endif // SUBSTITUTION_TABLE_H
@@ -0,0 +1,133 @@
+#include <iostream>
+#include <format>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+#include "build_instructions.h"
+#include "post_processing.h"
+#include "substitution_table.h"
+
+using namespace std::literals;
+
+// ----------------------------------------------------------------------------
+
+// Compares substitution_table::apply() with the search/erase/insert loop it replaced, which
+// runs each pair over the whole string in turn.  Every abstract and flag of the instruction
+// blocks is checked at the point post_processing() substitutes it, then random strings made
+// from the characters of the tables.
+
+// the reference: one pass per pair
+static std::string substitute_reference(std::string data, const substitution_table& symbols)
+{
+  for(const auto& spair : symbols.pairs())
+  {
+    auto pos = std::begin(data);
+    while(pos = std::search(pos, std::end(data), std::begin(spair.first), std::end(spair.first)),
+          pos != std::end(data))
+    {
+       pos = data.erase(pos, pos + spair.first.size());
+       pos = data.insert(pos, std::begin(spair.second), std::end(spair.second));
+       pos = std::next(pos, spair.second.size());
+    }
+  }
+  return data;
+}
+
+static std::size_t failures = 0;
+static std::size_t comparisons = 0;
+
+// the reference result, so the caller can carry on with it
+static std::string compare(const std::string& input, const substitution_table& symbols, std::string_view where)
+{
+  std::string expected = substitute_reference(input, symbols);
+  std::string result;
+  symbols.apply(input, result);
+  ++comparisons;
+  if(result != expected)
+  {
+    if(++failures <= 10)
+      std::cerr << std::format("{}: \"{}\"\n  expected \"{}\"\n  got      \"{}\"\n", where, input, expected, result);
+  }
+  return expected;
+}
+
+static void compare_rows(void)
+{
+  std::vector<instructions> insn_blocks;
+  build_insn_blocks(insn_blocks);
+
+  for(const auto& block : insn_blocks)
+  {
+    for(const auto& i : block)
+    {
+      const std::string_view mnemonic_text = i.data<mnemonic>();
+      for(const auto& flag : i.data<flags>())
+        if(flag.index() == 2)
+          compare(std::get<std::string>(flag), typeable_substitutions, std::format("{} flag", mnemonic_text));
+
+      for(mode_details md : i.data<std::vector<mode_details>>())
+      {
+        if(md.abstract_string.empty())
+          md.abstract_string = i.data<abstract>();
+        modes_decoder(i, md);
+
+        std::string where = std::format("{} ${:02X} abstract", mnemonic_text, md.opcode);
+        std::string text = compare(md.abstract_string, typeable_substitutions, where);
+        replace_patterns(text, typeable_regexes);
+        compare(text, long_accronym_substitutions, where);
+      }
+    }
+  }
+}
+
+static void compare_random(const substitution_table& symbols, std::string_view table_name, std::size_t count)
+{
+  std::string alphabet = " ";
+  for(const auto& spair : symbols.pairs())
+    for(std::string_view text : { spair.first, spair.second })
+      for(char c : text)
+        if(alphabet.find(c) == std::string::npos)
+          alphabet.push_back(c);
+
+  std::mt19937 generator(2024);
+  std::uniform_int_distribution<std::size_t> length(0, 48);
+  std::uniform_int_distribution<std::size_t> pick(0, alphabet.size() - 1);
+  std::uniform_int_distribution<std::size_t> pair_pick(0, symbols.pairs().size() - 1);
+  for(std::size_t pos = 0; pos < count; ++pos)
+  {
+    // characters mixed with whole search texts so that matches are common
+    std::string input;
+    for(std::size_t remaining = length(generator); remaining; --remaining)
+    {
+      if(pick(generator) % 4)
+        input.push_back(alphabet[pick(generator)]);
+      else
+        input.append(symbols.pairs()[pair_pick(generator)].first);
+    }
+    compare(input, symbols, table_name);
+  }
+}
+
+int main (int argc, char** argv)
+{
+  std::size_t random_count = argc > 1 ? std::size_t(std::atol(argv[1])) : 100000;
+
+  try
+  {
+    compare_rows();
+    compare_random(typeable_substitutions, "typeable random"sv, random_count);
+    compare_random(long_accronym_substitutions, "long acronym random"sv, random_count);
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << std::format("{} of {} substitutions differ\n", failures, comparisons);
+  return failures ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,194 @@
+#include "trace_decoder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std::literals::string_literals;
+
+namespace
+{
+  // 48MB of records per chunk
+  constexpr uint64_t chunk_records = 0x400000;
+  constexpr std::size_t address_count = std::size_t(256) << 13;
+
+  struct pc_counter
+  {
+    uint64_t executions;
+    uint64_t cycles;
+  };
+
+  struct job_totals
+  {
+    uint64_t unknown = 0;
+    std::array<trace_profile::opcode_totals, 256> opcodes = {};
+    std::vector<pc_counter> pcs = std::vector<pc_counter>(address_count); // 32MB, by bank << 13 | pc & 0x1FFF
+  };
+
+  class trace_file
+  {
+  public:
+    trace_file(const std::string& filename)
+      : fd(::open(filename.c_str(), O_RDONLY))
+    {
+      if(fd < 0)
+        throw "unable to open: "s + filename;
+    }
+    trace_file(const trace_file&) = delete;
+    trace_file& operator=(const trace_file&) = delete;
+    ~trace_file(void) { ::close(fd); }
+
+    const int fd;
+  };
+
+  class mapped_range
+  {
+  public:
+    mapped_range(int fd, uint64_t offset, uint64_t length)
+    {
+      static const uint64_t page_size = uint64_t(::sysconf(_SC_PAGESIZE));
+      uint64_t start = offset & ~(page_size - 1);
+      size = std::size_t(offset + length - start);
+      mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, off_t(start));
+      if(mapping == MAP_FAILED)
+        throw "unable to map trace records"s;
+      ::madvise(mapping, size, MADV_SEQUENTIAL);
+      data = static_cast<const uint8_t*>(mapping) + (offset - start);
+    }
+    mapped_range(const mapped_range&) = delete;
+    mapped_range& operator=(const mapped_range&) = delete;
+    ~mapped_range(void) { ::munmap(mapping, size); }
+
+    const uint8_t* data;
+
+  private:
+    void* mapping;
+    std::size_t size;
+  };
+}
+
+static void decode_records(const trace::record* records, uint64_t count, const opcode_table_t& table, job_totals& totals)
+{
+  for(uint64_t pos = 0; pos < count; ++pos)
+  {
+    const trace::record& entry = records[pos];
+    const opcode_entry& op = table[entry.bytes[0]];
+    if(!op.valid())
+    {
+      ++totals.unknown;
+      continue;
+    }
+
+    bool taken = op.cost.branch_taken && (entry.flags & trace::branch_taken);
+    uint32_t cycles = instruction_cycles(op, entry.bytes.data(), taken) + entry.extra_cycles;
+
+    trace_profile::opcode_totals& counts = totals.opcodes[entry.bytes[0]];
+    ++counts.executions;
+    counts.taken += taken;
+    counts.cycles += cycles;
+
+    pc_counter& pc = totals.pcs[(std::size_t(entry.bank) << 13) | (entry.pc & 0x1FFF)];
+    ++pc.executions;
+    pc.cycles += cycles;
+  }
+}
+
+trace_profile decode_trace(const std::string& filename, unsigned int jobs, std::size_t hot_count)
+{
+  trace_file file(filename);
+
+  struct stat info;
+  trace::header head;
+  if(::fstat(file.fd, &info) < 0 || info.st_size < off_t(sizeof(head)) ||
+     ::pread(file.fd, &head, sizeof(head), 0) != ssize_t(sizeof(head)) || head.magic != trace::magic)
+    throw "not an execution trace: "s + filename;
+  if(head.version != trace::version || head.record_size != sizeof(trace::record))
+    throw "unsupported trace version "s + std::to_string(head.version) + ": " + filename;
+  if(head.cpus != NMOS6502 && head.cpus != WDC65C02 && head.cpus != HuC6280)
+    throw "trace of an unknown isa: "s + filename;
+  if((uint64_t(info.st_size) - sizeof(head)) % sizeof(trace::record))
+    throw "truncated trace: "s + filename;
+
+  trace_profile profile;
+  profile.target = isa(head.cpus);
+  profile.records = (uint64_t(info.st_size) - sizeof(head)) / sizeof(trace::record);
+  const opcode_table_t& table = opcode_table(profile.target);
+
+  uint64_t chunk_count = (profile.records + chunk_records - 1) / chunk_records;
+  if(!jobs)
+    jobs = std::max(1U, std::thread::hardware_concurrency());
+  jobs = unsigned(std::max<uint64_t>(1, std::min<uint64_t>(jobs, chunk_count)));
+
+  std::vector<job_totals> totals(jobs);
+  std::atomic<uint64_t> next = 0;
+  std::exception_ptr failure;
+  std::mutex failure_lock;
+  auto worker = [&](job_totals& job)
+  {
+    for(uint64_t chunk; chunk = next.fetch_add(1, std::memory_order_relaxed), chunk < chunk_count; )
+    {
+      try
+      {
+        uint64_t first = chunk * chunk_records;
+        uint64_t count = std::min(chunk_records, profile.records - first);
+        mapped_range range(file.fd, sizeof(head) + first * sizeof(trace::record), count * sizeof(trace::record));
+        decode_records(reinterpret_cast<const trace::record*>(range.data), count, table, job);
+      }
+      catch(...)
+      {
+        std::lock_guard<std::mutex> guard(failure_lock);
+        if(!failure)
+          failure = std::current_exception();
+        next = chunk_count; // stop handing out work
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(unsigned int pos = 1; pos < jobs; ++pos)
+    threads.emplace_back(worker, std::ref(totals[pos]));
+  worker(totals[0]);
+  for(auto& thread : threads)
+    thread.join();
+
+  if(failure)
+    std::rethrow_exception(failure);
+
+  job_totals& sum = totals[0];
+  for(std::size_t job = 1; job < totals.size(); ++job)
+  {
+    sum.unknown += totals[job].unknown;
+    for(std::size_t opcode = 0; opcode < sum.opcodes.size(); ++opcode)
+    {
+      sum.opcodes[opcode].executions += totals[job].opcodes[opcode].executions;
+      sum.opcodes[opcode].taken += totals[job].opcodes[opcode].taken;
+      sum.opcodes[opcode].cycles += totals[job].opcodes[opcode].cycles;
+    }
+    for(std::size_t address = 0; address < address_count; ++address)
+    {
+      sum.pcs[address].executions += totals[job].pcs[address].executions;
+      sum.pcs[address].cycles += totals[job].pcs[address].cycles;
+    }
+  }
+
+  profile.unknown = sum.unknown;
+  profile.opcodes = sum.opcodes;
+  for(std::size_t address = 0; address < address_count; ++address)
+    if(sum.pcs[address].executions)
+      profile.hottest.push_back({ uint32_t(address), sum.pcs[address].executions, sum.pcs[address].cycles });
+
+  auto hotter = [](const trace_profile::pc_totals& a, const trace_profile::pc_totals& b)
+    { return a.cycles != b.cycles ? a.cycles > b.cycles : a.address < b.address; };
+  std::size_t kept = std::min(hot_count, profile.hottest.size());
+  std::partial_sort(std::begin(profile.hottest), std::begin(profile.hottest) + kept, std::end(profile.hottest), hotter);
+  profile.hottest.resize(kept);
+  return profile;
+}
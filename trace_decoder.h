@@ -0,0 +1,46 @@
+#ifndef TRACE_DECODER_H
+#define TRACE_DECODER_H
+
+#include "execution_trace.h"
+#include "opcode_table.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <string>
+#include <vector>
+
+// Execution counts and cycles of a trace written by trace_writer.  Each record is joined
+// with the opcode table of the trace's isa and costed with instruction_cycles(), so a taken
+// conditional branch and the length of a block transfer are included, plus the T flag and
+// decimal mode cycles the emulator recorded.  Cycles are counted the same at either clock
+// speed, so after a CSL or CSH they are not proportional to time.  The file is mapped
+// a chunk of records at a time and chunks are handed to the jobs in turn, so memory is
+// bounded by the jobs no matter how long the trace is.
+struct trace_profile
+{
+  struct opcode_totals
+  {
+    uint64_t executions;
+    uint64_t taken;               // conditional branches that went to their target
+    uint64_t cycles;
+  };
+
+  struct pc_totals
+  {
+    uint32_t address;             // bank << 13 | pc & 0x1FFF
+    uint64_t executions;
+    uint64_t cycles;
+  };
+
+  isa target = None;
+  uint64_t records = 0;
+  uint64_t unknown = 0;           // records whose opcode the isa does not have
+  std::array<opcode_totals, 256> opcodes = {};
+  std::vector<pc_totals> hottest; // by cycles, most first
+};
+
+// jobs of zero uses every core, hot_count limits trace_profile::hottest
+trace_profile decode_trace(const std::string& filename, unsigned int jobs, std::size_t hot_count);
+
+#endif // TRACE_DECODER_H
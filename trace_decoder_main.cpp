@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <iostream>
+#include <format>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+
+#include "disassembler.h"
+#include "trace_decoder.h"
+
+using namespace std::literals;
+using namespace std::string_view_literals;
+
+// ----------------------------------------------------------------------------
+
+// operand syntax of an addressing mode, e.g. "($nn),Y"
+static std::string mode_name(modes_t mode_data)
+{
+  std::string name;
+  for(char c : disassembler::operand_template(mode_data))
+  {
+    if(c == disassembler::byte_operand)
+      name.append("nn");
+    else if(c == disassembler::word_operand)
+      name.append("hhll");
+    else if(c == disassembler::relative_operand)
+      name.append("rr");
+    else
+      name.push_back(c);
+  }
+  return name.empty() ? "implied"s : name;
+}
+
+static std::string percent(uint64_t part, uint64_t whole)
+{
+  return std::format("{:6.2f}%", whole ? part * 100.0 / whole : 0.0);
+}
+
+int main (int argc, char** argv)
+{
+  std::ios::sync_with_stdio(false);
+
+  unsigned int jobs = 1;
+  std::size_t hot_count = 20;
+  std::vector<std::string_view> files;
+
+  for(int pos = 1; pos < argc; ++pos)
+  {
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--jobs="sv))
+      jobs = unsigned(std::atoi(argv[pos] + "--jobs="sv.size()));
+    else if(arg.starts_with("--top="sv))
+      hot_count = std::size_t(std::atoi(argv[pos] + "--top="sv.size()));
+    else
+      files.push_back(arg);
+  }
+
+  if(files.size() != 1)
+  {
+    std::cerr << "usage: " << argv[0] << " [--jobs=n] [--top=n] <trace>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    trace_profile profile = decode_trace(std::string(files[0]), jobs, hot_count);
+    const opcode_table_t& table = opcode_table(profile.target);
+
+    struct totals
+    {
+      uint64_t executions = 0;
+      uint64_t taken = 0;
+      uint64_t cycles = 0;
+    };
+
+    totals all;
+    std::map<std::string_view, totals> mnemonics;
+    std::map<std::string, totals> modes;
+    for(std::size_t opcode = 0; opcode < profile.opcodes.size(); ++opcode)
+    {
+      const trace_profile::opcode_totals& counts = profile.opcodes[opcode];
+      if(!counts.executions)
+        continue;
+      for(totals* sum : { &all, &mnemonics[table[opcode].mnemonic()], &modes[mode_name(table[opcode].mode_data)] })
+      {
+        sum->executions += counts.executions;
+        sum->taken += counts.taken;
+        sum->cycles += counts.cycles;
+      }
+    }
+
+    // most cycles first
+    auto by_cycles = [](const auto& group)
+    {
+      std::vector<std::pair<std::string_view, totals>> sorted(std::begin(group), std::end(group));
+      std::stable_sort(std::begin(sorted), std::end(sorted),
+                       [](const auto& a, const auto& b) { return a.second.cycles > b.second.cycles; });
+      return sorted;
+    };
+
+    std::string output = std::format("{:<20} {:>14} {:>14} {:>16} {:>8}\n", "mnemonic", "executions", "taken", "cycles", "cycles");
+    for(const auto& [name, sum] : by_cycles(mnemonics))
+      output += std::format("{:<20} {:>14} {:>14} {:>16} {}\n", name, sum.executions,
+                            sum.taken ? std::to_string(sum.taken) : "", sum.cycles, percent(sum.cycles, all.cycles));
+
+    output += std::format("\n{:<20} {:>14} {:>14} {:>16} {:>8}\n", "mode", "executions", "taken", "cycles", "cycles");
+    for(const auto& [name, sum] : by_cycles(modes))
+      output += std::format("{:<20} {:>14} {:>14} {:>16} {}\n", name, sum.executions,
+                            sum.taken ? std::to_string(sum.taken) : "", sum.cycles, percent(sum.cycles, all.cycles));
+
+    output += std::format("\n{:<20} {:>14} {:>14} {:>16} {:>8}\n", "bank:offset", "executions", "", "cycles", "cycles");
+    for(const trace_profile::pc_totals& pc : profile.hottest)
+      output += std::format("{:<20} {:>14} {:>14} {:>16} {}\n", std::format("{:02X}:{:04X}", pc.address >> 13, pc.address & 0x1FFF),
+                            pc.executions, "", pc.cycles, percent(pc.cycles, all.cycles));
+
+    output += std::format("\n{} records, {} instructions, {} cycles, {} unknown opcodes\n",
+                          profile.records, all.executions, all.cycles, profile.unknown);
+    std::cout << output;
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return 0;
+}
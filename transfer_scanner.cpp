@@ -0,0 +1,204 @@
+#include "transfer_scanner.h"
+
+#include <algorithm>
+#include <bit>
+#include <string>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TRANSFER_SCANNER_X86
+#include <immintrin.h>
+#endif
+
+using namespace std::literals::string_literals;
+
+static constexpr bool is_transfer_row(const opcode_row& row)
+{
+  return row.cpus & HuC6280 && (row.mode_data == Block || row.mnemonic == "TAM" || row.mnemonic == "TMA");
+}
+
+static constexpr std::size_t count_transfer_opcodes(void)
+{
+  std::size_t count = 0;
+  for(const opcode_row& row : opcode_rows)
+    count += is_transfer_row(row);
+  return count;
+}
+
+static constexpr std::array<uint8_t, count_transfer_opcodes()> build_transfer_opcodes(void)
+{
+  std::array<uint8_t, count_transfer_opcodes()> opcodes = {};
+  std::size_t count = 0;
+  for(const opcode_row& row : opcode_rows)
+    if(is_transfer_row(row))
+      opcodes[count++] = row.opcode;
+  return opcodes;
+}
+
+static constexpr std::array<uint8_t, count_transfer_opcodes()> transfer_opcodes = build_transfer_opcodes();
+static_assert(transfer_opcodes.size() == 7, "expected TII, TDD, TIN, TIA, TAI, TAM and TMA");
+
+static constexpr std::array<bool, 256> build_transfer_flags(void)
+{
+  std::array<bool, 256> flags = {};
+  for(uint8_t opcode : transfer_opcodes)
+    flags[opcode] = true;
+  return flags;
+}
+
+static constexpr std::array<bool, 256> transfer_flags = build_transfer_flags();
+
+bool is_transfer_opcode(uint8_t opcode)
+{
+  return transfer_flags[opcode];
+}
+
+// ----------------------------------------------------------------------------
+// each finder appends base + the offset of every transfer opcode in data[0, size)
+
+static void find_scalar(const uint8_t* data, std::size_t size, uint32_t base, std::vector<uint32_t>& found)
+{
+  for(std::size_t pos = 0; pos < size; ++pos)
+    if(transfer_flags[data[pos]])
+      found.push_back(base + uint32_t(pos));
+}
+
+static void append_mask(uint64_t mask, uint32_t base, std::vector<uint32_t>& found)
+{
+  for(; mask; mask &= mask - 1)
+    found.push_back(base + uint32_t(std::countr_zero(mask)));
+}
+
+#ifdef TRANSFER_SCANNER_X86
+__attribute__((target("sse2")))
+static void find_sse2(const uint8_t* data, std::size_t size, uint32_t base, std::vector<uint32_t>& found)
+{
+  __m128i wanted[transfer_opcodes.size()];
+  for(std::size_t pos = 0; pos < transfer_opcodes.size(); ++pos)
+    wanted[pos] = _mm_set1_epi8(char(transfer_opcodes[pos]));
+
+  std::size_t pos = 0;
+  for(; pos + 16 <= size; pos += 16)
+  {
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+    __m128i hits = _mm_setzero_si128();
+    for(const __m128i& opcode : wanted)
+      hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, opcode));
+    append_mask(uint32_t(_mm_movemask_epi8(hits)), base + uint32_t(pos), found);
+  }
+  find_scalar(data + pos, size - pos, base + uint32_t(pos), found);
+}
+
+// 64 bytes per iteration so most iterations test one mask and find nothing
+__attribute__((target("avx2")))
+static void find_avx2(const uint8_t* data, std::size_t size, uint32_t base, std::vector<uint32_t>& found)
+{
+  __m256i wanted[transfer_opcodes.size()];
+  for(std::size_t pos = 0; pos < transfer_opcodes.size(); ++pos)
+    wanted[pos] = _mm256_set1_epi8(char(transfer_opcodes[pos]));
+
+  std::size_t pos = 0;
+  for(; pos + 64 <= size; pos += 64)
+  {
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+    __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 32));
+    __m256i low_hits = _mm256_setzero_si256();
+    __m256i high_hits = _mm256_setzero_si256();
+    for(const __m256i& opcode : wanted)
+    {
+      low_hits = _mm256_or_si256(low_hits, _mm256_cmpeq_epi8(low, opcode));
+      high_hits = _mm256_or_si256(high_hits, _mm256_cmpeq_epi8(high, opcode));
+    }
+    append_mask(uint32_t(_mm256_movemask_epi8(low_hits)) | uint64_t(uint32_t(_mm256_movemask_epi8(high_hits))) << 32,
+                base + uint32_t(pos), found);
+  }
+  find_sse2(data + pos, size - pos, base + uint32_t(pos), found);
+}
+#endif
+
+bool scan_method_supported(scan_method method)
+{
+  switch(method)
+  {
+  case scalar_scan:
+    return true;
+#ifdef TRANSFER_SCANNER_X86
+  case sse2_scan:
+    return __builtin_cpu_supports("sse2");
+  case avx2_scan:
+    return __builtin_cpu_supports("avx2");
+#endif
+  default:
+    return false;
+  }
+}
+
+scan_method best_scan_method(void)
+{
+  if(scan_method_supported(avx2_scan))
+    return avx2_scan;
+  if(scan_method_supported(sse2_scan))
+    return sse2_scan;
+  return scalar_scan;
+}
+
+// ----------------------------------------------------------------------------
+
+transfer_totals scan_transfers(const uint8_t* data, std::size_t size, scan_method method, std::vector<transfer_site>* sites)
+{
+  if(size > UINT32_MAX)
+    throw "image is larger than 4GB"s;
+  if(!scan_method_supported(method))
+    throw "scan method is not supported by this CPU"s;
+
+  // candidates are decoded a chunk at a time so memory does not grow with the image
+  constexpr std::size_t chunk_size = 0x10000;
+  std::vector<uint32_t> candidates;
+  candidates.reserve(chunk_size);
+
+  transfer_totals totals;
+  for(std::size_t chunk = 0; chunk < size; chunk += chunk_size)
+  {
+    std::size_t length = std::min(chunk_size, size - chunk);
+    candidates.clear();
+    switch(method)
+    {
+#ifdef TRANSFER_SCANNER_X86
+    case avx2_scan:
+      find_avx2(data + chunk, length, uint32_t(chunk), candidates);
+      break;
+    case sse2_scan:
+      find_sse2(data + chunk, length, uint32_t(chunk), candidates);
+      break;
+#endif
+    default:
+      find_scalar(data + chunk, length, uint32_t(chunk), candidates);
+      break;
+    }
+
+    for(uint32_t offset : candidates)
+    {
+      const uint8_t* instruction = data + offset;
+      const opcode_entry& entry = huc6280_opcodes[instruction[0]];
+      if(std::size_t(offset) + entry.byte_count > size)
+        continue;
+
+      transfer_site site = { offset, 0, 0, 0, 0, instruction[0], 0 };
+      if(entry.mode_data == Block)
+      {
+        site.source = uint16_t(instruction[1] | (instruction[2] << 8));
+        site.destination = uint16_t(instruction[3] | (instruction[4] << 8));
+        site.length = block_length(instruction);
+      }
+      else
+        site.mask = instruction[1];
+      site.cycles = entry.cost.cycles(false, site.length);
+
+      ++totals.sites[site.opcode];
+      totals.bytes[site.opcode] += site.length;
+      totals.cycles[site.opcode] += site.cycles;
+      if(sites)
+        sites->push_back(site);
+    }
+  }
+  return totals;
+}
@@ -0,0 +1,50 @@
+#ifndef TRANSFER_SCANNER_H
+#define TRANSFER_SCANNER_H
+
+#include "opcode_table.h"
+
+#include <cstdint>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// Finds every byte of an image that could start a HuC6280 block transfer (TII, TDD, TIN, TIA,
+// TAI) or MMU remap (TAM, TMA) and decodes its operands.  Nothing follows control flow, so
+// data that happens to hold one of these opcodes is reported as well.  The opcodes are
+// matched 64 or 16 bytes at a time with AVX2 or SSE2 when the CPU has them.
+enum scan_method : uint8_t
+{
+  scalar_scan,
+  sse2_scan,
+  avx2_scan,
+};
+
+bool scan_method_supported(scan_method method);
+scan_method best_scan_method(void);
+
+struct transfer_site
+{
+  uint32_t offset;        // image offset of the opcode
+  uint16_t source;        // block transfers only
+  uint16_t destination;
+  uint32_t length;        // bytes moved by a block transfer, 1 to 65536
+  uint32_t cycles;        // 17 + 6 * length for a block transfer
+  uint8_t opcode;
+  uint8_t mask;           // MPR bits of TAM and TMA
+};
+
+struct transfer_totals
+{
+  std::array<uint64_t, 256> sites = {};   // by opcode
+  std::array<uint64_t, 256> bytes = {};
+  std::array<uint64_t, 256> cycles = {};
+};
+
+// the HuC6280 block transfer, TAM and TMA opcodes
+bool is_transfer_opcode(uint8_t opcode);
+
+// Scans size bytes and appends the sites in image order to sites unless it is null.  An
+// opcode whose operands would run past the end of the image is not a site.
+transfer_totals scan_transfers(const uint8_t* data, std::size_t size, scan_method method, std::vector<transfer_site>* sites);
+
+#endif // TRANSFER_SCANNER_H
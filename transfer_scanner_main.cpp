@@ -0,0 +1,116 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+
+#include "transfer_scanner.h"
+
+using namespace std::literals;
+using namespace std::string_view_literals;
+
+// ----------------------------------------------------------------------------
+
+static constexpr std::array<std::string_view, 3> method_names = { "scalar"sv, "sse2"sv, "avx2"sv };
+
+static bool parse_method(std::string_view name, scan_method& method)
+{
+  for(std::size_t pos = 0; pos < method_names.size(); ++pos)
+    if(name == method_names[pos])
+    {
+      method = scan_method(pos);
+      return true;
+    }
+  return false;
+}
+
+static std::vector<uint8_t> read_image(const std::string& filename)
+{
+  std::ifstream fileIn(filename, std::ios::binary | std::ios::ate);
+  if(!fileIn)
+    throw "unable to open: "s + filename;
+
+  std::vector<uint8_t> image(std::size_t(fileIn.tellg()));
+  fileIn.seekg(0);
+  if(!fileIn.read(reinterpret_cast<char*>(image.data()), std::streamsize(image.size())))
+    throw "unable to read: "s + filename;
+  return image;
+}
+
+int main (int argc, char** argv)
+{
+  std::ios::sync_with_stdio(false);
+
+  scan_method method = best_scan_method();
+  bool valid = true;
+  bool summary = false;
+  std::vector<std::string_view> files;
+
+  for(int pos = 1; pos < argc; ++pos)
+  {
+    std::string_view arg = argv[pos];
+    if(arg.starts_with("--method="sv))
+      valid &= parse_method(arg.substr("--method="sv.size()), method);
+    else if(arg == "--summary"sv)
+      summary = true;
+    else
+      files.push_back(arg);
+  }
+
+  if(files.size() != 1 || !valid)
+  {
+    std::cerr << "usage: " << argv[0] << " [--method=scalar|sse2|avx2] [--summary] <image>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try
+  {
+    std::vector<uint8_t> image = read_image(std::string(files[0]));
+    // a copier header only shifts the bank numbers, the scan itself covers every byte
+    uint32_t header = image.size() % 0x2000 == 512 ? 512 : 0;
+
+    std::vector<transfer_site> sites;
+    auto start = std::chrono::steady_clock::now();
+    transfer_totals totals = scan_transfers(image.data(), image.size(), method, summary ? nullptr : &sites);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::string output;
+    for(const transfer_site& site : sites)
+    {
+      uint32_t offset = site.offset - std::min(site.offset, header);
+      std::string_view name = huc6280_opcodes[site.opcode].mnemonic();
+      if(site.length)
+        output += std::format("{:02X}:{:04X}  {} ${:04X},${:04X},${:04X}  {:5} bytes  {:6} cycles\n",
+                              offset / 0x2000, offset % 0x2000, name, site.source, site.destination,
+                              site.length & 0xFFFF, site.length, site.cycles);
+      else
+        output += std::format("{:02X}:{:04X}  {} #${:02X}  {:33} cycles\n",
+                              offset / 0x2000, offset % 0x2000, name, site.mask, site.cycles);
+    }
+
+    uint64_t site_count = 0, bytes = 0, cycles = 0;
+    for(std::size_t opcode = 0; opcode < totals.sites.size(); ++opcode)
+      if(totals.sites[opcode])
+      {
+        output += std::format("{}  {:8} sites  {:10} bytes  {:12} cycles\n", huc6280_opcodes[opcode].mnemonic(),
+                              totals.sites[opcode], totals.bytes[opcode], totals.cycles[opcode]);
+        site_count += totals.sites[opcode];
+        bytes += totals.bytes[opcode];
+        cycles += totals.cycles[opcode];
+      }
+
+    output += std::format("{} sites, {} bytes, {} cycles, {} bytes scanned in {:.2f} ms with {}\n",
+                          site_count, bytes, cycles, image.size(), elapsed.count() * 1000, method_names[method]);
+    std::cout << output;
+  }
+  catch (std::string message)
+  {
+    std::cerr << "exception caught: " << message << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return 0;
+}